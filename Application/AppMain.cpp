@@ -58,6 +58,9 @@ extern "C" void AppMain(void)
   // Init Input Driver Task
   InputDrv::GetInstance().InitTask(nullptr, &hadc2);
 
+  // Init Pattern Generator Task
+  PatternGen::GetInstance().InitTask();
+
   // Init Application Task
   Application::GetInstance().InitTask();
 }
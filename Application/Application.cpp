@@ -21,9 +21,21 @@
 #include "Application.h"
 
 #include <cmath>
+#include <cstring>
 
 #include "Images.h"
 
+// *****************************************************************************
+// ***   Channel hardware   ****************************************************
+// *****************************************************************************
+const Application::ChannelHwType Application::CHANNEL_HW[CHANNEL_CNT] =
+{
+  {true,  &htim7, DAC_CHANNEL_2, 0U, &hdma_dac2, 0U,          nullptr,             0U,            nullptr,               0U,              0U,            nullptr, 0U,            0U},
+  {true,  &htim6, DAC_CHANNEL_1, 1U, &hdma_dac1, 0U,          nullptr,             0U,            nullptr,               0U,              0U,            nullptr, 0U,            0U},
+  {false, &htim5, TIM_CHANNEL_4, 0U, nullptr,    TIM_TS_ITR1, STEP_DIR3_GPIO_Port, STEP_DIR3_Pin, PWM_CH3_OUT_GPIO_Port, PWM_CH3_OUT_Pin, GPIO_AF2_TIM5, &htim9,  TIM_CHANNEL_2, GPIO_AF3_TIM9},
+  {false, &htim2, TIM_CHANNEL_3, 1U, nullptr,    TIM_TS_ITR2, STEP_DIR4_GPIO_Port, STEP_DIR4_Pin, PWM_CH4_OUT_GPIO_Port, PWM_CH4_OUT_Pin, GPIO_AF1_TIM2, &htim9,  TIM_CHANNEL_1, GPIO_AF3_TIM9}
+};
+
 // *****************************************************************************
 // ***   Get Instance   ********************************************************
 // *****************************************************************************
@@ -49,12 +61,12 @@ Result Application::Loop()
     ch_dsc[i].frequency = 1000U * (i + 1U);
     if(IsAnalogChannel(i))
     {
-      ch_dsc[i].duty = 100U;
+      ch_dsc[i].duty = DUTY_FULL;
       ch_dsc[i].waveform = WAVEFORM_SINE;
     }
     else
     {
-      ch_dsc[i].duty = 50U;
+      ch_dsc[i].duty = DUTY_FULL / 2;
       ch_dsc[i].waveform = WAVEFORM_SQUARE;
     }
     // UI data
@@ -62,35 +74,62 @@ Result Application::Loop()
     int32_t start_pos_y = half_scr_h * (i/2);
     ch_dsc[i].box.SetParams(nullptr, start_pos_x, start_pos_y, half_scr_w, half_scr_h, true);
     ch_dsc[i].box.SetCallback(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(&Callback), this);
+    ch_dsc[i].edit_btn.SetParams(nullptr, start_pos_x + 2, start_pos_y + 62, half_scr_w - 4, 28, true);
+    ch_dsc[i].edit_btn.SetCallback(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(&Callback), this);
     ch_dsc[i].freq_str.SetParams(ch_dsc[i].freq_str_data, start_pos_x + 4, start_pos_y + 64, COLOR_LIGHTGREY, Font_8x12::GetInstance());
     ch_dsc[i].duty_str.SetParams(ch_dsc[i].duty_str_data, start_pos_x + 4, start_pos_y + 64 + 12, COLOR_LIGHTGREY, Font_8x12::GetInstance());
+    ch_dsc[i].mode_str.SetParams(ch_dsc[i].mode_str_data, start_pos_x + 4, start_pos_y + 92, COLOR_LIGHTGREY, Font_8x12::GetInstance());
+    ch_dsc[i].param_str.SetParams(ch_dsc[i].param_str_data, start_pos_x + 4, start_pos_y + 92 + 12, COLOR_LIGHTGREY, Font_8x12::GetInstance());
+    ch_dsc[i].trig_str.SetParams(ch_dsc[i].trig_str_data, start_pos_x + 84, start_pos_y + 4, COLOR_LIGHTGREY, Font_8x12::GetInstance());
+    ch_dsc[i].edge_str.SetParams(ch_dsc[i].edge_str_data, start_pos_x + 84, start_pos_y + 24, COLOR_LIGHTGREY, Font_8x12::GetInstance());
+    ch_dsc[i].res_str.SetParams(ch_dsc[i].res_str_data, start_pos_x + 84, start_pos_y + 40, COLOR_LIGHTGREY, Font_8x12::GetInstance());
     ch_dsc[i].img.SetImage(waveforms[ch_dsc[i].waveform]);
     ch_dsc[i].img.Move(start_pos_x + 4, start_pos_y + 4);
     ch_dsc[i].box.Show(1);
+    ch_dsc[i].edit_btn.Show(2);
     ch_dsc[i].img.Show(2);
+    // Live preview of DAC buffer for analog channels, below trigger string
+    if(IsAnalogChannel(i))
+    {
+      ch_dsc[i].preview.SetParams(start_pos_x + 84, start_pos_y + 16, half_scr_w - 88, 44);
+      ch_dsc[i].preview.Show(2);
+    }
+    else // Pulse width and duty encoder resolution for digital channels
+    {
+      ch_dsc[i].edge_str.Show(3);
+      ch_dsc[i].res_str.Show(3);
+    }
     ch_dsc[i].freq_str.Show(3);
     ch_dsc[i].duty_str.Show(3);
+    ch_dsc[i].mode_str.Show(3);
+    ch_dsc[i].param_str.Show(3);
+    ch_dsc[i].trig_str.Show(3);
   }
 
-  // ***************************************************************************
-  // ***   CHANNEL 1 (DAC)   ***************************************************
-  // ***************************************************************************
-  SetupDac(hdac, DAC_CHANNEL_2, htim7, ch_dsc[0U].frequency, ch_dsc[0U].duty, ch_dsc[0U].waveform);
-
-  // ***************************************************************************
-  // ***   CHANNEL 2 (DAC)   ***************************************************
-  // ***************************************************************************
-  SetupDac(hdac, DAC_CHANNEL_1, htim6, ch_dsc[1U].frequency, ch_dsc[1U].duty, ch_dsc[1U].waveform);
+  // Keypad uses whole screen, but not shown until value edit is requested
+  keypad.Setup(0, 0, display_drv.GetScreenW(), display_drv.GetScreenH());
 
-  // ***************************************************************************
-  // ***   CHANNEL 3 (PWM)   ***************************************************
-  // ***************************************************************************
-  SetupPwm(htim5, TIM_CHANNEL_4, ch_dsc[2U].frequency, ch_dsc[2U].duty);
+  // Debug string
+  if(APPLICATION_DEBUG_INFO)
+  {
+    dbg_str.SetParams(dbg_str_data, 4, display_drv.GetScreenH() - 12, COLOR_YELLOW, Font_8x12::GetInstance());
+    dbg_str.Show(4);
+    trig_dbg_str.SetParams(trig_dbg_str_data, 4, display_drv.GetScreenH() - 24, COLOR_YELLOW, Font_8x12::GetInstance());
+    trig_dbg_str.Show(4);
+    pat_dbg_str.SetParams(pat_dbg_str_data, 4, display_drv.GetScreenH() - 36, COLOR_YELLOW, Font_8x12::GetInstance());
+    pat_dbg_str.Show(4);
+    // Enable cycle counter to measure formatting time
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  }
 
-  // ***************************************************************************
-  // ***   CHANNEL 4 (PWM)   ***************************************************
-  // ***************************************************************************
-  SetupPwm(htim2, TIM_CHANNEL_3, ch_dsc[3U].frequency, ch_dsc[3U].duty);
+  // Setup all channels
+  for(uint32_t i = 0U; i < CHANNEL_CNT; i++)
+  {
+    ApplyChannel(i);
+  }
+  // Start trigger input capture
+  (void) HAL_TIM_IC_Start_IT(&htim3, TIM_CHANNEL_1);
 
   // Main cycle
   while(1)
@@ -103,93 +142,91 @@ Result Application::Loop()
     if(input_drv.GetEncoderButtonState(InputDrv::EXT_LEFT, InputDrv::ENC_BTN_ENT, enc_btn_val[InputDrv::EXT_LEFT][InputDrv::ENC_BTN_ENT]) && enc_btn_val[InputDrv::EXT_LEFT][InputDrv::ENC_BTN_ENT])
     {
       // Process selected channel change
-      channel = (ChannelType)(channel + 1U);
-      if(channel >= CHANNEL_CNT) channel = CHANNEL_1;
+      SelectChannel((channel + 1U < CHANNEL_CNT) ? (ChannelType)(channel + 1U) : CHANNEL_1);
       // Set flag for update
       update = true;
     }
     // Change waveform
     if(input_drv.GetEncoderButtonState(InputDrv::EXT_RIGHT, InputDrv::ENC_BTN_ENT, enc_btn_val[InputDrv::EXT_RIGHT][InputDrv::ENC_BTN_ENT]) && enc_btn_val[InputDrv::EXT_RIGHT][InputDrv::ENC_BTN_ENT])
     {
-      if(IsAnalogChannel(channel))
-      {
-        ch_dsc[channel].waveform = (WaveformType)(ch_dsc[channel].waveform + 1U);
-        if(ch_dsc[channel].waveform >= WAVEFORM_CNT) ch_dsc[channel].waveform = WAVEFORM_SINE;
-      }
-      else
-      {
-        ch_dsc[channel].waveform = WAVEFORM_SQUARE;
-      }
+      // Digital channels have only square wave, button changes duty resolution
+      if(IsAnalogChannel(channel)) NextWaveform(channel);
+      else                         NextDutyRes(channel);
       // Set flag for update
       update = true;
     }
 
     // Get encoder 1 count since last call and pass it to the function
-    update |= ProcessFrequencyChange(input_drv.GetEncoderState(InputDrv::EXT_LEFT));
+    int32_t freq_steps = input_drv.GetEncoderState(InputDrv::EXT_LEFT);
+    update |= ProcessFrequencyChange(freq_steps);
 
     // Get encoder 2 count since last call and pass it to the function
-    update |= ProcessDutyChange(input_drv.GetEncoderState(InputDrv::EXT_RIGHT));
+    int32_t duty_steps = input_drv.GetEncoderState(InputDrv::EXT_RIGHT);
+    update |= ProcessDutyChange(duty_steps);
+
+    // Trigger statistics should be shown
+    if(APPLICATION_DEBUG_INFO && (trig_cnt != trig_cnt_shown))
+    {
+      update = true;
+    }
+    // Pattern stream underruns should be shown
+    if(APPLICATION_DEBUG_INFO && (pattern.GetUnderruns() != pattern_underruns_shown))
+    {
+      update = true;
+    }
+    // Break of complementary output should be shown
+    if(IsComplBreak() != compl_break_shown)
+    {
+      compl_break_shown = !compl_break_shown;
+      if(compl_ch < CHANNEL_CNT) ch_dsc[compl_ch].dirty |= DIRTY_MODE;
+      update = true;
+    }
 
     // ***************************************************************************
     // ***   Update UI and generator if needed   *********************************
     // ***************************************************************************
     if(update == true)
     {
-      for(uint32_t i = 0U; i < CHANNEL_CNT; i++)
+      // Redraw only changed UI elements
+      UpdateUi();
+      // Debug info
+      if(APPLICATION_DEBUG_INFO)
       {
-        ch_dsc[i].img.SetImage(waveforms[ch_dsc[i].waveform]);
-        ch_dsc[i].freq_str.SetString(ch_dsc[i].freq_str_data, NumberOf(ch_dsc[i].freq_str_data), "Freq: %7lu Hz", ch_dsc[i].frequency);
-        if(IsAnalogChannel(i)) ch_dsc[i].duty_str.SetString(ch_dsc[i].duty_str_data, NumberOf(ch_dsc[i].duty_str_data), "Ampl: %7d %%", ch_dsc[i].duty);
-        else                   ch_dsc[i].duty_str.SetString(ch_dsc[i].duty_str_data, NumberOf(ch_dsc[i].duty_str_data), "Duty: %7d %%", ch_dsc[i].duty);
-        // Set gray color to all channels
-        ch_dsc[i].freq_str.SetColor(COLOR_LIGHTGREY);
-        ch_dsc[i].duty_str.SetColor(COLOR_LIGHTGREY);
+        dbg_str.SetString(dbg_str_data, NumberOf(dbg_str_data), "Drop: %lu Px: %lu Fmt: %lu ISR: %lu", dropped_updates, update_pixels, format_cycles,
+                          dds[CHANNEL_1].fill_cycles + dds[CHANNEL_2].fill_cycles + pwm_stream[0U].fill_cycles + pwm_stream[1U].fill_cycles);
+        // Latency in ns, TIM3 clocked from APB1 timer clock
+        uint32_t clk_mhz = (HAL_RCC_GetPCLK1Freq() * 2U) / 1000000U;
+        trig_cnt_shown = trig_cnt;
+        trig_dbg_str.SetString(trig_dbg_str_data, NumberOf(trig_dbg_str_data), "Trg: %lu SW: %lu-%lu HW: %lu-%lu ns", trig_cnt_shown,
+                               (trig_cnt_shown ? trig_sw_min : 0U) * 1000U / clk_mhz, trig_sw_max * 1000U / clk_mhz,
+                               (trig_hw_max ? trig_hw_min : 0U) * 1000U / clk_mhz, trig_hw_max * 1000U / clk_mhz);
+        static const char* const PATTERN_MODE_NAMES[PatternGen::MODE_CNT] = {"Loop", "Burst", "Stream"};
+        pattern_underruns_shown = pattern.GetUnderruns();
+        pat_dbg_str.SetString(pat_dbg_str_data, NumberOf(pat_dbg_str_data), "Pat: %s %lu Hz Len: %lu Urun: %lu",
+                              PATTERN_MODE_NAMES[pattern_mode], pattern.IsRunning() ? pattern.GetRate() : 0U,
+                              pattern.GetLen(), pattern_underruns_shown);
       }
-      // Set white color to selected channel
-      ch_dsc[channel].freq_str.SetColor(COLOR_WHITE);
-      ch_dsc[channel].duty_str.SetColor(COLOR_WHITE);
       // Update display
       display_drv.UpdateDisplay();
 
-      // Set duty cycle
-      switch(channel)
-      {
-        // *************************************************************************
-        // ***   CHANNEL 1 (DAC)   *************************************************
-        // *************************************************************************
-        case CHANNEL_1:
-          SetupDac(hdac, DAC_CHANNEL_2, htim7, ch_dsc[channel].frequency, ch_dsc[channel].duty, ch_dsc[channel].waveform);
-          break;
-
-        // *************************************************************************
-        // ***   CHANNEL 2 (DAC)   *************************************************
-        // *************************************************************************
-        case CHANNEL_2:
-          SetupDac(hdac, DAC_CHANNEL_1, htim6, ch_dsc[channel].frequency, ch_dsc[channel].duty, ch_dsc[channel].waveform);
-          break;
-
-        // *************************************************************************
-        // ***   CHANNEL 3 (PWM)   *************************************************
-        // *************************************************************************
-        case CHANNEL_3:
-          SetupPwm(htim5, TIM_CHANNEL_4, ch_dsc[channel].frequency, ch_dsc[channel].duty);
-          break;
-
-        // *************************************************************************
-        // ***   CHANNEL 4 (PWM)   *************************************************
-        // *************************************************************************
-        case CHANNEL_4:
-          SetupPwm(htim2, TIM_CHANNEL_3, ch_dsc[channel].frequency, ch_dsc[channel].duty);
-          break;
-
-        default:
-          result = Result::ERR_BAD_PARAMETER;
-          break;
-      }
+      // Request generator update with the latest parameters
+      RequestApply(channel);
       update = false;
     }
 
-    // Delay
+    // Apply pending generator parameters to the hardware
+    ProcessApply((freq_steps != 0) || (duty_steps != 0));
+
+    // Streamed DAC data changes all the time, so preview should follow it
+    for(uint8_t ch = 0U; ch < CHANNEL_CNT; ch++)
+    {
+      if(IsAnalogChannel(ch) && dds[CHANNEL_HW[ch].slot].active)
+      {
+        UpdatePreview(ch, dds[CHANNEL_HW[ch].slot].buf, DAC_STREAM_BLOCK * 2U);
+      }
+    }
+
+    // Delay, pattern stream is refilled by its own task
     RtosTick::DelayMs(100U);
   }
 
@@ -203,6 +240,7 @@ Result Application::Loop()
 Result Application::Callback(Application* app, void* ptr)
 {
   ChannelType channel = CHANNEL_CNT;
+  bool is_edit = false;
 
   // Find which channel is touched
   for(uint32_t i = 0u; i < NumberOf(app->ch_dsc); i++)
@@ -212,28 +250,33 @@ Result Application::Callback(Application* app, void* ptr)
       channel = (ChannelType)i;
       break;
     }
+    if(ptr == &app->ch_dsc[i].edit_btn)
+    {
+      channel = (ChannelType)i;
+      is_edit = true;
+      break;
+    }
   }
 
-  // If we found the channel(always should be)
-  if(channel < CHANNEL_CNT)
+  // If we found the channel(always should be) and keypad isn't shown
+  if((channel < CHANNEL_CNT) && (app->keypad.IsOpen() == false))
   {
+    // Touch on values - open keypad for direct entry
+    if(is_edit)
+    {
+      static const char* const titles[CHANNEL_CNT] = {"CH1: ", "CH2: ", "CH3: ", "CH4: "};
+      app->SelectChannel(channel);
+      app->keypad.Open(titles[channel], reinterpret_cast<CallbackPtr>(&KeypadCallback), app);
+    }
     // If selected channel is touched
-    if(channel == app->channel)
+    else if(channel == app->channel)
     {
       // Second click - change wave type
-      if(app->IsAnalogChannel(app->channel))
-      {
-        app->ch_dsc[channel].waveform = (WaveformType)(app->ch_dsc[channel].waveform + 1U);
-        if(app->ch_dsc[channel].waveform >= WAVEFORM_CNT) app->ch_dsc[channel].waveform = WAVEFORM_SINE;
-      }
-      else
-      {
-        app->ch_dsc[channel].waveform = WAVEFORM_SQUARE;
-      }
+      app->NextWaveform(channel);
     }
     else // Select another one
     {
-      app->channel = channel;
+      app->SelectChannel(channel);
     }
     app->update = true;
   }
@@ -242,237 +285,3359 @@ Result Application::Callback(Application* app, void* ptr)
   return Result::RESULT_OK;
 }
 
-
 // *****************************************************************************
-// ***   ProcessFrequencyChange   **********************************************
+// ***  Callback for the keypad   **********************************************
 // *****************************************************************************
-bool Application::ProcessFrequencyChange(int32_t steps)
+Result Application::KeypadCallback(Application* app, Keypad* kp)
 {
-  bool result = false;
+  uint64_t value = kp->GetValueMilli();
+  ChannelDescriptionType& dsc = app->ch_dsc[app->channel];
+  // Entered frequency in Hz
+  int64_t freq = -1;
+  Keypad::UnitType unit = kp->GetUnit();
 
-  // Change Frequency
-  if(steps != 0)
+  // Pattern generator and hop list have own sets of parameters
+  if(kp->GetTarget() == Keypad::TARGET_PAT)
   {
-    // Change frequency
-    if(ch_dsc[channel].frequency >= 1000000)
-    {
-      ch_dsc[channel].frequency += steps * 100000;
-    }
-    else if(ch_dsc[channel].frequency >= 100000)
-    {
-      ch_dsc[channel].frequency += steps * 10000;
-      if(ch_dsc[channel].frequency > 1000000) ch_dsc[channel].frequency = 1000000;
-    }
-    else if(ch_dsc[channel].frequency >= 10000)
-    {
-      ch_dsc[channel].frequency += steps * 1000;
-      if(ch_dsc[channel].frequency > 100000) ch_dsc[channel].frequency = 100000;
-    }
-    else
-    {
-      ch_dsc[channel].frequency += steps * 100;
-      if(ch_dsc[channel].frequency > 10000) ch_dsc[channel].frequency = 10000;
-    }
-    // Check absolute minimum
-    if(ch_dsc[channel].frequency < 100) ch_dsc[channel].frequency = 100;
-    // Check absolute maximum
-    if(IsAnalogChannel(channel))
-    {
-      if(ch_dsc[channel].frequency > 200000) ch_dsc[channel].frequency = 200000;
-    }
-    else
-    {
-      if(ch_dsc[channel].frequency > 10000000) ch_dsc[channel].frequency = 10000000;
-    }
-    // Set flag for update
-    result = true;
+    app->ProcessPatternEntry(unit, value);
+    unit = Keypad::UNIT_NONE;
   }
-
-  return result;
-}
-
-// *****************************************************************************
-// ***   ProcessDutyChange   ***************************************************
-// *****************************************************************************
-bool Application::ProcessDutyChange(int32_t steps)
-{
-  bool result = false;
-
-  // Change Frequency
-  if(steps != 0)
+  else if(kp->GetTarget() == Keypad::TARGET_HOP)
   {
-    int8_t max_val = 0;
-    // Find maximum value
-    if(IsAnalogChannel(channel))
-    {
-      max_val = 100;
-    }
-    else
-    {
-      max_val = 99;
-    }
-    // Process amplitude/duty change
-    ch_dsc[channel].duty += steps;
-    if(ch_dsc[channel].duty < 1) ch_dsc[channel].duty = max_val;
-    if(ch_dsc[channel].duty > max_val) ch_dsc[channel].duty = 1;
-    // Set flag for update
-    result = true;
+    app->ProcessHopEntry(unit, value);
+    unit = Keypad::UNIT_NONE;
   }
 
-  return result;
-}
+  // Unit defines which parameter is entered
+  switch(unit)
+  {
+    case Keypad::UNIT_HZ:
+      freq = value / 1000U;
+      break;
 
-// *****************************************************************************
-// ***   GenerateWave   ********************************************************
-// *****************************************************************************
-Result Application::GenerateWave(uint16_t* dac_data, uint32_t dac_data_cnt, uint8_t duty, WaveformType waveform)
-{
-  Result result;
+    case Keypad::UNIT_KHZ:
+      freq = value;
+      break;
 
-  uint32_t max_val = (DAC_MAX_VAL * duty) / 100U;
-  uint32_t shift = (DAC_MAX_VAL - max_val) / 2U;
+    case Keypad::UNIT_MHZ:
+      freq = value * 1000U;
+      break;
 
-  switch(waveform)
-  {
-    case WAVEFORM_SINE:
-      for(uint32_t i = 0U; i < dac_data_cnt; i++)
+    case Keypad::UNIT_PERCENT:
+      if(kp->GetTarget() != Keypad::TARGET_DEV) app->SetDuty(app->channel, value * (DUTY_FULL / 100000));
+      else if(dsc.mode == MODE_SPREAD)          app->SetSpread(app->channel, value / 1000U);
+      else                                      app->SetModDepth(app->channel, value / 1000U);
+      break;
+
+    case Keypad::UNIT_MV:
+      // Amplitude in mV can be set only for analog channels and PWM-DAC
+      if(IsAnalogChannel(app->channel) || app->IsPwmDac(app->channel))
       {
-        dac_data[i] = (uint16_t)((sin((2.0F * i * PI) / (dac_data_cnt + 1)) + 1.0F) * max_val) >> 1U;
-        dac_data[i] += shift;
+        app->SetDuty(app->channel, (value / 1000U * DUTY_FULL + DAC_VREF_MV / 2U) / DAC_VREF_MV);
       }
       break;
 
-    case WAVEFORM_TRIANGLE:
-      for(uint32_t i = 0U; i < dac_data_cnt; i++)
+    case Keypad::UNIT_S:
+      // Value in milliseconds
+      if(dsc.mode == MODE_BURST)     app->SetBurstPeriod(app->channel, value);
+      else if(dsc.mode == MODE_STEP) app->SetStepRamp(app->channel, value);
+      else                           app->SetSweepTime(app->channel, value);
+      break;
+
+    case Keypad::UNIT_CYCLES:
+      if(dsc.mode == MODE_HOP)       app->SetHopDwell(app->channel, value / 1000U);
+      else if(dsc.mode == MODE_STEP) app->SetStepCount(app->channel, value / 1000U);
+      else                           app->SetBurstCycles(app->channel, value / 1000U);
+      break;
+
+    case Keypad::UNIT_ERR:
+      app->SetPrbsErrPeriod(app->channel, value / 1000U);
+      break;
+
+    case Keypad::UNIT_NS:
+      app->SetDeadTime(app->channel, value / 1000U);
+      break;
+
+    case Keypad::UNIT_DEG:
+      // Value in millidegrees
+      app->SetPhaseSpacing(app->channel, value);
+      break;
+
+    case Keypad::ACTION_MODE:
+      app->NextMode(app->channel);
+      break;
+
+    case Keypad::ACTION_SHAPE:
+      // Noise type, PRBS pattern, spread pattern, phase count, stepper
+      // profile, sweep law or modulation LFO shape
+      if(dsc.waveform == WAVEFORM_NOISE)
       {
-        if(i <= dac_data_cnt / 2U)
-        {
-          dac_data[i] = (max_val * i) / (dac_data_cnt / 2U);
-        }
-        else
-        {
-          dac_data[i] = (max_val * (dac_data_cnt - i)) / (dac_data_cnt / 2U);
-        }
-        dac_data[i] += shift;
+        dsc.noise = (NoiseType)(dsc.noise + 1U);
+        if(dsc.noise >= NOISE_CNT) dsc.noise = NOISE_WHITE;
+      }
+      else if(dsc.mode == MODE_PRBS)
+      {
+        dsc.prbs = (PrbsType)(dsc.prbs + 1U);
+        if(dsc.prbs >= PRBS_CNT) dsc.prbs = PRBS_7;
+      }
+      else if(dsc.mode == MODE_SPREAD)
+      {
+        dsc.spread_shape = (SpreadType)(dsc.spread_shape + 1U);
+        if(dsc.spread_shape >= SPREAD_CNT) dsc.spread_shape = SPREAD_TRIANGLE;
+      }
+      else if(dsc.mode == MODE_PHASE)
+      {
+        dsc.phase_cnt++;
+        if(dsc.phase_cnt > MAX_PHASES) dsc.phase_cnt = MIN_PHASES;
+      }
+      else if(dsc.mode == MODE_STEP)
+      {
+        dsc.step_profile = (StepProfileType)(dsc.step_profile + 1U);
+        if(dsc.step_profile >= STEP_PROFILE_CNT) dsc.step_profile = STEP_TRAPEZOID;
+      }
+      else if(IsModulationMode(dsc.mode))
+      {
+        // Noise can't be used as LFO
+        dsc.mod_shape = (WaveformType)(dsc.mod_shape + 1U);
+        if(dsc.mod_shape >= WAVEFORM_NOISE) dsc.mod_shape = WAVEFORM_SINE;
       }
+      else
+      {
+        dsc.sweep_law = (Sweep::LawType)(dsc.sweep_law + 1U);
+        if(dsc.sweep_law >= Sweep::LAW_CNT) dsc.sweep_law = Sweep::LAW_LIN;
+      }
+      dsc.dirty |= DIRTY_MODE;
       break;
 
-    case WAVEFORM_SAWTOOTH:
-      for(uint32_t i = 0U; i < dac_data_cnt; i++)
+    case Keypad::ACTION_DIR:
+      // Stepper direction or sweep direction
+      if(dsc.mode == MODE_STEP)
       {
-        dac_data[i] = (max_val * i) / (dac_data_cnt - 1U);
-        dac_data[i] += shift;
+        dsc.step_dir = !dsc.step_dir;
+      }
+      else
+      {
+        dsc.sweep_dir = (Sweep::DirType)(dsc.sweep_dir + 1U);
+        if(dsc.sweep_dir >= Sweep::DIR_CNT) dsc.sweep_dir = Sweep::DIR_UP;
       }
+      dsc.dirty |= DIRTY_MODE;
       break;
 
-    case WAVEFORM_SQUARE:
-      for(uint32_t i = 0U; i < dac_data_cnt; i++)
+    case Keypad::ACTION_TRIG:
+      // Complementary output has no trigger, key re-arms output after break.
+      // Stepper has no trigger too, key starts the move again.
+      if(dsc.mode == MODE_COMPL)
       {
-        dac_data[i] = (i < dac_data_cnt / 2U) ? max_val : 0x000;
-        dac_data[i] += shift;
+        dsc.compl_arm++;
+      }
+      else if(dsc.mode == MODE_STEP)
+      {
+        dsc.step_run++;
       }
+      else
+      {
+        dsc.trig = (TrigType)(dsc.trig + 1U);
+        if(dsc.trig >= TRIG_CNT) dsc.trig = TRIG_OFF;
+      }
+      dsc.dirty |= DIRTY_MODE;
       break;
 
-    default:
-      result = Result::ERR_BAD_PARAMETER;
+    default: // Cancelled
       break;
   }
+  // Frequency is main frequency, sweep stop frequency or modulation rate.
+  // Spread triangle rate is modulation rate too, second frequency of stepper
+  // is start rate.
+  if(freq >= 0)
+  {
+    if(kp->GetTarget() == Keypad::TARGET_MAIN)                       app->SetFrequency(app->channel, freq);
+    else if(IsModulationMode(dsc.mode) || (dsc.mode == MODE_SPREAD)) app->SetModRate(app->channel, freq);
+    else if(dsc.mode == MODE_STEP)                                   app->SetStepStart(app->channel, freq);
+    else                                                             app->SetSweepStop(app->channel, freq);
+  }
+  // Redraw screen after keypad is closed and apply new value
+  app->update = true;
 
-  return result;
+  // Always run
+  return Result::RESULT_OK;
 }
 
 // *****************************************************************************
-// ***   Setup DAC   ***********************************************************
+// ***   SelectChannel   *******************************************************
 // *****************************************************************************
-Result Application::SetupDac(DAC_HandleTypeDef& hdac, uint32_t channel, TIM_HandleTypeDef& htim, uint32_t freq, uint8_t duty, WaveformType waveform)
+void Application::SelectChannel(ChannelType ch)
 {
-  Result result;
-
-  uint16_t* dac_data = nullptr;
-  uint32_t dac_data_cnt = 0U;
-  uint32_t freq_sampling = 4000000U;
+  if(ch != channel)
+  {
+    // Both previously selected and new selected channel should change color
+    ch_dsc[channel].dirty |= DIRTY_COLOR;
+    ch_dsc[ch].dirty |= DIRTY_COLOR;
+    channel = ch;
+  }
+}
 
-  if(channel == DAC_CHANNEL_1)
+// *****************************************************************************
+// ***   NextWaveform   ********************************************************
+// *****************************************************************************
+void Application::NextWaveform(ChannelType ch)
+{
+  if(IsAnalogChannel(ch))
   {
-    dac_data = dac1_data;
-    dac_data_cnt = NumberOf(dac1_data);
+    ch_dsc[ch].waveform = (WaveformType)(ch_dsc[ch].waveform + 1U);
+    if(ch_dsc[ch].waveform >= WAVEFORM_CNT) ch_dsc[ch].waveform = WAVEFORM_SINE;
+    // Waveform image should be redrawn, noise has own mode string
+    ch_dsc[ch].dirty |= DIRTY_IMG | DIRTY_MODE;
   }
   else
   {
-    dac_data = dac2_data;
-    dac_data_cnt = NumberOf(dac2_data);
+    // Digital channel in continuous mode outputs sine, triangle and sawtooth
+    // as PWM-DAC, square is regular PWM. Noise isn't available.
+    if(ch_dsc[ch].mode == MODE_CONTINUOUS)
+    {
+      ch_dsc[ch].waveform = (WaveformType)(ch_dsc[ch].waveform + 1U);
+      if(ch_dsc[ch].waveform >= WAVEFORM_NOISE) ch_dsc[ch].waveform = WAVEFORM_SINE;
+    }
+    else
+    {
+      ch_dsc[ch].waveform = WAVEFORM_SQUARE;
+    }
+    // Duty becomes amplitude and PWM-DAC has lower frequency limit
+    SetFrequency(ch, ch_dsc[ch].frequency);
+    ch_dsc[ch].dirty |= DIRTY_IMG | DIRTY_MODE | DIRTY_DUTY;
   }
+}
 
-  // Find sampling frequency
-  while(freq_sampling/freq > dac_data_cnt) freq_sampling >>= 1U;
-  // Find count
-  dac_data_cnt = freq_sampling/freq;
-  // Generate waveform
-  GenerateWave(dac_data, dac_data_cnt, duty, waveform);
-
-  // Stop timer
-  (void) HAL_TIM_Base_Stop(&htim);
-  // Stop DAC DMA
-  (void) HAL_DAC_Stop_DMA(&hdac, channel);
-  // Calculate ARR
-  uint16_t arr = ((HAL_RCC_GetPCLK1Freq() * 2U) / freq_sampling) - 1U;
-  // Prevent set to zero
-  if(arr < 20U) arr = 20U;
-  // Set period
-  htim.Instance->ARR = arr;
-  // Generate an update event
-  htim.Instance->EGR = TIM_EGR_UG;
-  // Start DAC DMA
-  (void) HAL_DAC_Start_DMA(&hdac, channel, (uint32_t*)dac_data, dac_data_cnt, DAC_ALIGN_12B_R);
-  // Start timer
-  (void) HAL_TIM_Base_Start(&htim);
+// *****************************************************************************
+// ***   NextMode   ************************************************************
+// *****************************************************************************
+void Application::NextMode(ChannelType ch)
+{
+  do
+  {
+    ch_dsc[ch].mode = (ModeType)(ch_dsc[ch].mode + 1U);
+    if(ch_dsc[ch].mode >= MODE_CNT) ch_dsc[ch].mode = MODE_CONTINUOUS;
+  }
+  // Modulation is available only for analog channels, PRBS, dithering,
+  // hopping, spread spectrum, complementary output and stepper only for
+  // digital.
+  // Complementary output has one timer, so only one channel can use it.
+  // Interleaved bank needs TIM2 as master, so it is output of its channel.
+  while((IsModulationMode(ch_dsc[ch].mode) && !IsAnalogChannel(ch)) ||
+        (((ch_dsc[ch].mode == MODE_PRBS) || (ch_dsc[ch].mode == MODE_DITHER) ||
+          (ch_dsc[ch].mode == MODE_HOP) || (ch_dsc[ch].mode == MODE_SPREAD) ||
+          (ch_dsc[ch].mode == MODE_COMPL) || (ch_dsc[ch].mode == MODE_STEP)) && IsAnalogChannel(ch)) ||
+        ((ch_dsc[ch].mode == MODE_COMPL) && IsComplUsed(ch)) ||
+        ((ch_dsc[ch].mode == MODE_PHASE) && (ch != PHASE_CHANNEL)));
+  // PWM-DAC is available only in continuous mode
+  if(!IsAnalogChannel(ch) && (ch_dsc[ch].waveform != WAVEFORM_SQUARE))
+  {
+    ch_dsc[ch].waveform = WAVEFORM_SQUARE;
+    ch_dsc[ch].dirty |= DIRTY_IMG | DIRTY_DUTY | DIRTY_FREQ;
+  }
+  // Pulse width string isn't shown for complementary output and interleaved
+  // bank
+  if(!IsAnalogChannel(ch))
+  {
+    ch_dsc[ch].dirty |= DIRTY_DUTY;
+  }
+  // Mode strings should be redrawn
+  ch_dsc[ch].dirty |= DIRTY_MODE;
+}
 
-  return result;
+// *****************************************************************************
+// ***   NextDutyRes   *********************************************************
+// *****************************************************************************
+void Application::NextDutyRes(ChannelType ch)
+{
+  ch_dsc[ch].duty_res = (DutyResType)(ch_dsc[ch].duty_res + 1U);
+  if(ch_dsc[ch].duty_res >= DUTY_RES_CNT) ch_dsc[ch].duty_res = DUTY_RES_COARSE;
+  // Resolution string should be redrawn
+  ch_dsc[ch].dirty |= DIRTY_DUTY;
 }
 
 // *****************************************************************************
-// ***   Setup PWM   ***********************************************************
+// ***   UpdateUi   ************************************************************
 // *****************************************************************************
-Result Application::SetupPwm(TIM_HandleTypeDef& htim, uint32_t channel, uint32_t freq, uint8_t duty)
+void Application::UpdateUi()
 {
-  Result result;
+  update_pixels = 0U;
+  format_cycles = 0U;
 
-  if((duty > 0U) && (duty < 100U))
+  for(uint32_t i = 0U; i < CHANNEL_CNT; i++)
   {
-    // Set period
-    htim.Instance->ARR = (HAL_RCC_GetPCLK1Freq() * 2U) / freq;
-    // Set duty cycle
-    switch(channel)
+    ChannelDescriptionType& dsc = ch_dsc[i];
+    // Take flags, so changes from callback during update will not be lost
+    uint8_t dirty = dsc.dirty;
+    dsc.dirty = DIRTY_NONE;
+
+    if(dirty & DIRTY_IMG)
     {
-      case TIM_CHANNEL_1:
-        htim.Instance->CCR1 = (htim.Instance->ARR * duty) / 100U;
-        break;
-      case TIM_CHANNEL_2:
-        htim.Instance->CCR2 = (htim.Instance->ARR * duty) / 100U;
-        break;
-      case TIM_CHANNEL_3:
-        htim.Instance->CCR3 = (htim.Instance->ARR * duty) / 100U;
-        break;
-      case TIM_CHANNEL_4:
-        htim.Instance->CCR4 = (htim.Instance->ARR * duty) / 100U;
-        break;
-      default:
-        result = Result::ERR_BAD_PARAMETER;
-        break;
+      dsc.img.SetImage(waveforms[dsc.waveform]);
+      update_pixels += dsc.img.GetWidth() * dsc.img.GetHeight();
     }
-    if(result.IsGood())
+    if(dirty & DIRTY_COLOR)
     {
-      // Generate an update event
-      htim.Instance->EGR = TIM_EGR_UG;
-      // Start timer in PWM mode
-      (void) HAL_TIM_PWM_Start(&htim, channel);
+      color_t color = (i == channel) ? COLOR_WHITE : COLOR_LIGHTGREY;
+      dsc.freq_str.SetColor(color);
+      dsc.duty_str.SetColor(color);
+      dsc.mode_str.SetColor(color);
+      dsc.param_str.SetColor(color);
+      dsc.trig_str.SetColor(color);
+      dsc.edge_str.SetColor(color);
+      dsc.res_str.SetColor(color);
+    }
+    if(dirty & DIRTY_FREQ)
+    {
+      uint32_t start_cycles = DWT->CYCCNT;
+      NumFormatter::Frequency(dsc.freq_str_data, NumberOf(dsc.freq_str_data), "Freq: ", dsc.frequency);
+      format_cycles += DWT->CYCCNT - start_cycles;
+      dsc.freq_str.SetString(dsc.freq_str_data);
+    }
+    if(dirty & DIRTY_DUTY)
+    {
+      uint32_t start_cycles = DWT->CYCCNT;
+      // PWM-DAC amplitude is fraction of logic level, it is the same as DAC
+      // reference
+      if(IsAnalogChannel(i) || IsPwmDac(i))
+      {
+        NumFormatter::Value(dsc.duty_str_data, NumberOf(dsc.duty_str_data), "Ampl: ", ((uint64_t)dsc.duty * DAC_VREF_MV) / DUTY_FULL, 0U, "mV");
+        dsc.res_str_data[0U] = '\0';
+      }
+      else
+      {
+        static const char* const RES_NAMES[DUTY_RES_CNT] = {"Step 1%", "Step .01%", "Step 1clk"};
+        NumFormatter::Value(dsc.duty_str_data, NumberOf(dsc.duty_str_data), "Duty: ", (dsc.duty + DUTY_STEP_FINE / 2) / DUTY_STEP_FINE, 2U, "%");
+        const char* end = dsc.res_str_data + NumberOf(dsc.res_str_data) - 1U;
+        *NumFormatter::Str(dsc.res_str_data, end, RES_NAMES[dsc.duty_res]) = '\0';
+      }
+      format_cycles += DWT->CYCCNT - start_cycles;
+      dsc.duty_str.SetString(dsc.duty_str_data);
+      dsc.res_str.SetString(dsc.res_str_data);
+    }
+    // Pulse width depends on both frequency and duty, PWM-DAC has no fixed
+    // pulse width
+    if((dirty & (DIRTY_FREQ | DIRTY_DUTY)) && !IsAnalogChannel(i))
+    {
+      uint32_t start_cycles = DWT->CYCCNT;
+      uint32_t clk = GetChannelPwmClock(i);
+      uint32_t ccr = DutyToCcr(clk / dsc.frequency - 1U, dsc.duty);
+      const char* end = dsc.edge_str_data + NumberOf(dsc.edge_str_data) - 1U;
+      char* ptr = dsc.edge_str_data;
+      if(!IsPwmDac(i) && (dsc.mode != MODE_COMPL) && (dsc.mode != MODE_PHASE))
+      {
+        ptr = NumFormatter::Str(ptr, end, "W:");
+        ptr = NumFormatter::TimePs(ptr, end, (ccr * 1000000000000ULL) / clk);
+      }
+      *ptr = '\0';
+      format_cycles += DWT->CYCCNT - start_cycles;
+      dsc.edge_str.SetString(dsc.edge_str_data);
+    }
+    // Achieved average duty and frequency of dithering depend on both,
+    // PWM-DAC sampling frequency and actual PRBS bit rate depend on frequency
+    if((dirty & (DIRTY_FREQ | DIRTY_DUTY)) && ((dsc.mode == MODE_DITHER) || (dsc.mode == MODE_PRBS) || IsPwmDac(i)))
+    {
+      dirty |= DIRTY_MODE;
+    }
+    if(dirty & DIRTY_MODE)
+    {
+      uint32_t start_cycles = DWT->CYCCNT;
+      UpdateModeStrings(i);
+      format_cycles += DWT->CYCCNT - start_cycles;
+      dsc.mode_str.SetString(dsc.mode_str_data);
+      dsc.param_str.SetString(dsc.param_str_data);
+      dsc.trig_str.SetString(dsc.trig_str_data);
+    }
+    // Count string areas
+    if(dirty & (DIRTY_FREQ | DIRTY_COLOR))
+    {
+      update_pixels += dsc.freq_str.GetWidth() * dsc.freq_str.GetHeight();
+    }
+    if(dirty & (DIRTY_DUTY | DIRTY_COLOR))
+    {
+      update_pixels += dsc.duty_str.GetWidth() * dsc.duty_str.GetHeight();
+      if(!IsAnalogChannel(i)) update_pixels += dsc.res_str.GetWidth() * dsc.res_str.GetHeight();
+    }
+    if((dirty & (DIRTY_FREQ | DIRTY_DUTY | DIRTY_COLOR)) && !IsAnalogChannel(i))
+    {
+      update_pixels += dsc.edge_str.GetWidth() * dsc.edge_str.GetHeight();
+    }
+    if(dirty & (DIRTY_MODE | DIRTY_COLOR))
+    {
+      update_pixels += dsc.mode_str.GetWidth() * dsc.mode_str.GetHeight();
+      update_pixels += dsc.param_str.GetWidth() * dsc.param_str.GetHeight();
+      update_pixels += dsc.trig_str.GetWidth() * dsc.trig_str.GetHeight();
     }
   }
-  else
+}
+
+// *****************************************************************************
+// ***   UpdateModeStrings   ***************************************************
+// *****************************************************************************
+void Application::UpdateModeStrings(uint8_t ch)
+{
+  static const char* const LAW_NAMES[Sweep::LAW_CNT] = {" Lin", " Log"};
+  static const char* const DIR_NAMES[Sweep::DIR_CNT] = {" Up", " Dn", " UpDn"};
+  static const char* const MOD_NAMES[MODE_CNT] = {"", "", "AM", "FM", "PM"};
+  static const char* const SHAPE_NAMES[WAVEFORM_CNT] = {" Sin", " Tri", " Saw", " Sqr"};
+  static const char* const TRIG_NAMES[TRIG_CNT] = {"", "T:Start", "T:Stop", "T:Step"};
+  static const char* const NOISE_NAMES[NOISE_CNT] = {" White", " Gauss", " Pink"};
+  static const char* const PRBS_NAMES[PRBS_CNT] = {"PRBS7", "PRBS9", "PRBS15", "PRBS23", "PRBS31"};
+
+  ChannelDescriptionType& dsc = ch_dsc[ch];
+  const char* end = dsc.mode_str_data + NumberOf(dsc.mode_str_data) - 1U;
+  char* ptr = dsc.mode_str_data;
+  bool is_noise = (dsc.waveform == WAVEFORM_NOISE);
+  bool is_pwm_dac = IsPwmDac(ch);
+
+  if(IsPhaseSlave(ch))
+  {
+    // Channel timer is used by interleaved bank, own parameters are kept
+    ptr = NumFormatter::Str(ptr, end, "Phase bank CH4");
+    *ptr = '\0';
+    dsc.param_str_data[0U] = '\0';
+  }
+  else if(is_noise)
+  {
+    // Noise ignores mode. Output example: "Noise Pink", "BW: 500.000 kHz"
+    ptr = NumFormatter::Str(ptr, end, "Noise");
+    ptr = NumFormatter::Str(ptr, end, NOISE_NAMES[dsc.noise]);
+    *ptr = '\0';
+    NumFormatter::Frequency(dsc.param_str_data, NumberOf(dsc.param_str_data), "BW: ", DAC_STREAM_FS / 2U);
+  }
+  else if(dsc.mode == MODE_SWEEP)
+  {
+    // Output example: "Swp Log UpDn 100.0s", "Swp Lin Up 500ms"
+    ptr = NumFormatter::Str(ptr, end, "Swp");
+    ptr = NumFormatter::Str(ptr, end, LAW_NAMES[dsc.sweep_law]);
+    ptr = NumFormatter::Str(ptr, end, DIR_NAMES[dsc.sweep_dir]);
+    ptr = NumFormatter::Str(ptr, end, " ");
+    ptr = NumFormatter::Time(ptr, end, dsc.sweep_time_ms);
+    *ptr = '\0';
+    NumFormatter::Frequency(dsc.param_str_data, NumberOf(dsc.param_str_data), "Stop: ", dsc.sweep_stop);
+  }
+  else if(IsModulationMode(dsc.mode))
+  {
+    // Output example: "AM Sin 50%"
+    ptr = NumFormatter::Str(ptr, end, MOD_NAMES[dsc.mode]);
+    ptr = NumFormatter::Str(ptr, end, SHAPE_NAMES[dsc.mod_shape]);
+    ptr = NumFormatter::Str(ptr, end, " ");
+    ptr = NumFormatter::Fixed(ptr, end, dsc.mod_depth, 0U, 0U);
+    ptr = NumFormatter::Str(ptr, end, "%");
+    *ptr = '\0';
+    NumFormatter::Frequency(dsc.param_str_data, NumberOf(dsc.param_str_data), "Rate: ", dsc.mod_rate);
+  }
+  else if(dsc.mode == MODE_BURST)
+  {
+    // Output example: "Burst 10 cyc", "Period: 100ms", "Period: 120ms min"
+    // if burst is longer than requested period
+    uint32_t period_ms = GetBurstPeriod(ch);
+    ptr = NumFormatter::Str(ptr, end, "Burst ");
+    ptr = NumFormatter::Fixed(ptr, end, dsc.burst_cycles, 0U, 0U);
+    ptr = NumFormatter::Str(ptr, end, " cyc");
+    *ptr = '\0';
+    end = dsc.param_str_data + NumberOf(dsc.param_str_data) - 1U;
+    ptr = NumFormatter::Str(dsc.param_str_data, end, "Period: ");
+    ptr = NumFormatter::Time(ptr, end, period_ms);
+    if(period_ms != dsc.burst_period_ms) ptr = NumFormatter::Str(ptr, end, " min");
+    *ptr = '\0';
+  }
+  else if(dsc.mode == MODE_PRBS)
+  {
+    // Output example: "PRBS15 4.941176 MHz", "Err: 1/1000". Frequency is
+    // requested bit rate, mode string shows actual one.
+    uint32_t arr = GetPrbsArr(dsc.frequency);
+    ptr = NumFormatter::Str(ptr, end, PRBS_NAMES[dsc.prbs]);
+    ptr = NumFormatter::Str(ptr, end, " ");
+    NumFormatter::Frequency(ptr, end - ptr + 1U, "", (GetPwmClock() + arr / 2U) / (arr + 1U));
+    end = dsc.param_str_data + NumberOf(dsc.param_str_data) - 1U;
+    ptr = NumFormatter::Str(dsc.param_str_data, end, "Err: ");
+    if(dsc.prbs_err_period == 0U)
+    {
+      ptr = NumFormatter::Str(ptr, end, "off");
+    }
+    else
+    {
+      ptr = NumFormatter::Str(ptr, end, "1/");
+      ptr = NumFormatter::Fixed(ptr, end, dsc.prbs_err_period, 0U, 0U);
+    }
+    *ptr = '\0';
+  }
+  else if(dsc.mode == MODE_DITHER)
+  {
+    // Output example: "Dither 33.333%", "Out:   10.500000 MHz". Values are
+    // actually output average duty and frequency, not requested ones.
+    uint32_t arr = GetPwmArr(dsc.frequency);
+    uint64_t period_cnt = (uint64_t)(arr + 1U) * DITHER_LEN;
+    uint32_t duty = ((uint64_t)GetDitherCnt(arr, dsc.duty) * 100000U + period_cnt / 2U) / period_cnt;
+    ptr = NumFormatter::Str(ptr, end, "Dither ");
+    ptr = NumFormatter::Fixed(ptr, end, duty, 3U, 0U);
+    ptr = NumFormatter::Str(ptr, end, "%");
+    *ptr = '\0';
+    NumFormatter::Frequency(dsc.param_str_data, NumberOf(dsc.param_str_data), "Out: ", (GetPwmClock() + arr / 2U) / (arr + 1U));
+  }
+  else if(dsc.mode == MODE_SPREAD)
+  {
+    // Output example: "Spread Tri 5%", "Rate:   10.000 kHz". Random pattern
+    // has no rate.
+    static const char* const SPREAD_NAMES[SPREAD_CNT] = {" Tri ", " Rnd "};
+    ptr = NumFormatter::Str(ptr, end, "Spread");
+    ptr = NumFormatter::Str(ptr, end, SPREAD_NAMES[dsc.spread_shape]);
+    ptr = NumFormatter::Fixed(ptr, end, dsc.spread, 0U, 0U);
+    ptr = NumFormatter::Str(ptr, end, "%");
+    *ptr = '\0';
+    if(dsc.spread_shape == SPREAD_TRIANGLE) NumFormatter::Frequency(dsc.param_str_data, NumberOf(dsc.param_str_data), "Rate: ", dsc.mod_rate);
+    else                                    dsc.param_str_data[0U] = '\0';
+  }
+  else if(dsc.mode == MODE_HOP)
+  {
+    // Output example: "FSK 100 cyc", "F2:   12.000 kHz" for empty list or
+    // "Hop 5x100 cyc", "Last: 1.500000 MHz"
+    if(dsc.hop_cnt == 0U)
+    {
+      ptr = NumFormatter::Str(ptr, end, "FSK ");
+    }
+    else
+    {
+      ptr = NumFormatter::Str(ptr, end, "Hop ");
+      ptr = NumFormatter::Fixed(ptr, end, dsc.hop_cnt, 0U, 0U);
+      ptr = NumFormatter::Str(ptr, end, "x");
+    }
+    ptr = NumFormatter::Fixed(ptr, end, dsc.hop_dwell, 0U, 0U);
+    ptr = NumFormatter::Str(ptr, end, " cyc");
+    *ptr = '\0';
+    if(dsc.hop_cnt == 0U) NumFormatter::Frequency(dsc.param_str_data, NumberOf(dsc.param_str_data), "F2: ", dsc.sweep_stop);
+    else                  NumFormatter::Frequency(dsc.param_str_data, NumberOf(dsc.param_str_data), "Last: ", dsc.hops[dsc.hop_cnt - 1U].frequency);
+  }
+  else if(dsc.mode == MODE_COMPL)
+  {
+    // Output example: "Compl DT:101.19ns", "CH1N:PA7 Brk:PB12". Dead-time is
+    // actually inserted one, rounded to dead-time generator steps.
+    ptr = NumFormatter::Str(ptr, end, "Compl ");
+    if(IsComplBreak())
+    {
+      ptr = NumFormatter::Str(ptr, end, "BREAK");
+    }
+    else
+    {
+      uint32_t clk = GetComplClock();
+      uint32_t dt = 0U;
+      (void) DeadTimeToDtg(((uint64_t)dsc.dead_time_ns * clk) / 1000000000U, dt);
+      ptr = NumFormatter::Str(ptr, end, "DT:");
+      ptr = NumFormatter::TimePs(ptr, end, ((uint64_t)dt * 1000000000000ULL) / clk);
+    }
+    *ptr = '\0';
+    end = dsc.param_str_data + NumberOf(dsc.param_str_data) - 1U;
+    ptr = NumFormatter::Str(dsc.param_str_data, end, "PA8/PA7 Brk:PB12");
+    *ptr = '\0';
+  }
+  else if(dsc.mode == MODE_PHASE)
+  {
+    // Output example: "Phase 4x90.0deg", "A2 A3 B11 A0 Pat3:off" - pins of
+    // phases in order of phase shift, pattern generator bit 3 isn't output
+    // while B11 is used. "No timer" if phases need more counters.
+    uint32_t spacing = GetPhaseSpacing(dsc.phase_cnt, dsc.phase_spacing);
+    PhaseBankType plan;
+    ptr = NumFormatter::Str(ptr, end, "Phase ");
+    ptr = NumFormatter::Fixed(ptr, end, dsc.phase_cnt, 0U, 0U);
+    ptr = NumFormatter::Str(ptr, end, "x");
+    ptr = NumFormatter::Fixed(ptr, end, spacing / 100U, 1U, 0U);
+    ptr = NumFormatter::Str(ptr, end, "deg");
+    *ptr = '\0';
+    end = dsc.param_str_data + NumberOf(dsc.param_str_data) - 1U;
+    ptr = dsc.param_str_data;
+    if(PlanPhases(dsc.phase_cnt, spacing, plan))
+    {
+      for(uint32_t i = 0U; i < dsc.phase_cnt; i++)
+      {
+        if(i != 0U) ptr = NumFormatter::Str(ptr, end, " ");
+        ptr = NumFormatter::Str(ptr, end, phase_timers[plan.out[i] / 2U].pins[plan.out[i] % 2U]);
+      }
+      if(plan.used[0U] & 2U) ptr = NumFormatter::Str(ptr, end, " Pat3:off");
+    }
+    else
+    {
+      ptr = NumFormatter::Str(ptr, end, "No timer");
+    }
+    *ptr = '\0';
+  }
+  else if(dsc.mode == MODE_STEP)
+  {
+    // Output example: "Step Trap 1000 Fw", "Ramp:500ms 1000Hz" - ramp time
+    // from start rate to frequency and start rate
+    static const char* const STEP_NAMES[STEP_PROFILE_CNT] = {"Trap ", "S-crv "};
+    ptr = NumFormatter::Str(ptr, end, "Step ");
+    ptr = NumFormatter::Str(ptr, end, STEP_NAMES[dsc.step_profile]);
+    ptr = NumFormatter::Fixed(ptr, end, dsc.step_cnt, 0U, 0U);
+    ptr = NumFormatter::Str(ptr, end, dsc.step_dir ? " Rv" : " Fw");
+    *ptr = '\0';
+    end = dsc.param_str_data + NumberOf(dsc.param_str_data) - 1U;
+    ptr = NumFormatter::Str(dsc.param_str_data, end, "Ramp:");
+    ptr = NumFormatter::Time(ptr, end, dsc.step_ramp_ms);
+    ptr = NumFormatter::Str(ptr, end, " ");
+    ptr = NumFormatter::Fixed(ptr, end, dsc.step_start, 0U, 0U);
+    ptr = NumFormatter::Str(ptr, end, "Hz");
+    *ptr = '\0';
+  }
+  else if(is_pwm_dac)
+  {
+    // Output example: "PWM-DAC 328 smp", "Fs:  109.890 kHz". Sampling
+    // frequency is PWM frequency, RC filter cut-off should be well below it.
+    uint32_t len = GetPwmDacLen(dsc.frequency);
+    uint32_t fs = GetPwmClock() / (GetPwmClock() / (dsc.frequency * len));
+    ptr = NumFormatter::Str(ptr, end, "PWM-DAC ");
+    ptr = NumFormatter::Fixed(ptr, end, len, 0U, 0U);
+    ptr = NumFormatter::Str(ptr, end, " smp");
+    *ptr = '\0';
+    NumFormatter::Frequency(dsc.param_str_data, NumberOf(dsc.param_str_data), "Fs: ", fs);
+  }
+  else
+  {
+    // Output example: "Continuous", "Step: 5.952ns TIM9" - edge step of
+    // digital channel and APB2 timer if it outputs PWM
+    ptr = NumFormatter::Str(ptr, end, "Continuous");
+    *ptr = '\0';
+    end = dsc.param_str_data + NumberOf(dsc.param_str_data) - 1U;
+    ptr = dsc.param_str_data;
+    if(!IsAnalogChannel(ch))
+    {
+      ptr = NumFormatter::Str(ptr, end, "Step: ");
+      ptr = NumFormatter::TimePs(ptr, end, 1000000000000ULL / GetChannelPwmClock(ch));
+      if(hires_ch == ch) ptr = NumFormatter::Str(ptr, end, " TIM9");
+    }
+    *ptr = '\0';
+  }
+
+  // Trigger input used only in continuous mode
+  end = dsc.trig_str_data + NumberOf(dsc.trig_str_data) - 1U;
+  ptr = NumFormatter::Str(dsc.trig_str_data, end, ((dsc.mode == MODE_CONTINUOUS) && !is_noise && !is_pwm_dac && !IsPhaseSlave(ch)) ? TRIG_NAMES[dsc.trig] : "");
+  *ptr = '\0';
+}
+
+// *****************************************************************************
+// ***   SetFrequency   ********************************************************
+// *****************************************************************************
+void Application::SetFrequency(ChannelType ch, int64_t freq)
+{
+  if(freq < MIN_FREQ) freq = MIN_FREQ;
+  if(freq > GetMaxFrequency(ch)) freq = GetMaxFrequency(ch);
+  ch_dsc[ch].frequency = freq;
+  // Frequency string should be redrawn, burst period can be extended by
+  // longer cycles
+  ch_dsc[ch].dirty |= DIRTY_FREQ;
+  if(ch_dsc[ch].mode == MODE_BURST) ch_dsc[ch].dirty |= DIRTY_MODE;
+}
+
+// *****************************************************************************
+// ***   SetDuty   *************************************************************
+// *****************************************************************************
+void Application::SetDuty(ChannelType ch, int64_t duty)
+{
+  if(duty < 1) duty = 1;
+  if(duty > GetMaxDuty(ch)) duty = GetMaxDuty(ch);
+  ch_dsc[ch].duty = duty;
+  // Duty string should be redrawn
+  ch_dsc[ch].dirty |= DIRTY_DUTY;
+}
+
+// *****************************************************************************
+// ***   SetSweepStop   ********************************************************
+// *****************************************************************************
+void Application::SetSweepStop(ChannelType ch, int64_t freq)
+{
+  if(freq < MIN_FREQ) freq = MIN_FREQ;
+  if(freq > GetMaxFrequency(ch)) freq = GetMaxFrequency(ch);
+  ch_dsc[ch].sweep_stop = freq;
+  // Mode strings should be redrawn
+  ch_dsc[ch].dirty |= DIRTY_MODE;
+}
+
+// *****************************************************************************
+// ***   SetSweepTime   ********************************************************
+// *****************************************************************************
+void Application::SetSweepTime(ChannelType ch, uint64_t time_ms)
+{
+  if(time_ms < MIN_SWEEP_TIME_MS) time_ms = MIN_SWEEP_TIME_MS;
+  if(time_ms > MAX_SWEEP_TIME_MS) time_ms = MAX_SWEEP_TIME_MS;
+  ch_dsc[ch].sweep_time_ms = time_ms;
+  // Mode strings should be redrawn
+  ch_dsc[ch].dirty |= DIRTY_MODE;
+}
+
+// *****************************************************************************
+// ***   SetModRate   **********************************************************
+// *****************************************************************************
+void Application::SetModRate(ChannelType ch, int64_t rate)
+{
+  if(rate < MIN_MOD_RATE) rate = MIN_MOD_RATE;
+  if(rate > MAX_MOD_RATE) rate = MAX_MOD_RATE;
+  ch_dsc[ch].mod_rate = rate;
+  // Mode strings should be redrawn
+  ch_dsc[ch].dirty |= DIRTY_MODE;
+}
+
+// *****************************************************************************
+// ***   SetModDepth   *********************************************************
+// *****************************************************************************
+void Application::SetModDepth(ChannelType ch, int64_t depth)
+{
+  if(depth < 0) depth = 0;
+  if(depth > 100) depth = 100;
+  ch_dsc[ch].mod_depth = depth;
+  // Mode strings should be redrawn
+  ch_dsc[ch].dirty |= DIRTY_MODE;
+}
+
+// *****************************************************************************
+// ***   SetSpread   ***********************************************************
+// *****************************************************************************
+void Application::SetSpread(ChannelType ch, int64_t spread)
+{
+  if(spread < MIN_SPREAD) spread = MIN_SPREAD;
+  if(spread > MAX_SPREAD) spread = MAX_SPREAD;
+  ch_dsc[ch].spread = spread;
+  // Mode strings should be redrawn
+  ch_dsc[ch].dirty |= DIRTY_MODE;
+}
+
+// *****************************************************************************
+// ***   SetDeadTime   *********************************************************
+// *****************************************************************************
+void Application::SetDeadTime(ChannelType ch, uint64_t time_ns)
+{
+  // Zero disables dead-time insertion
+  if(time_ns > MAX_DEAD_TIME_NS) time_ns = MAX_DEAD_TIME_NS;
+  ch_dsc[ch].dead_time_ns = time_ns;
+  // Mode strings should be redrawn
+  ch_dsc[ch].dirty |= DIRTY_MODE;
+}
+
+// *****************************************************************************
+// ***   SetPhaseSpacing   *****************************************************
+// *****************************************************************************
+void Application::SetPhaseSpacing(ChannelType ch, uint64_t spacing)
+{
+  // Zero means evenly spaced phases
+  if(spacing > MAX_PHASE_SPACING) spacing = MAX_PHASE_SPACING;
+  ch_dsc[ch].phase_spacing = spacing;
+  // Mode strings should be redrawn
+  ch_dsc[ch].dirty |= DIRTY_MODE;
+}
+
+// *****************************************************************************
+// ***   SetStepCount   ********************************************************
+// *****************************************************************************
+void Application::SetStepCount(ChannelType ch, uint64_t steps)
+{
+  if(steps < 1U) steps = 1U;
+  if(steps > MAX_STEPS) steps = MAX_STEPS;
+  ch_dsc[ch].step_cnt = steps;
+  // Mode strings should be redrawn
+  ch_dsc[ch].dirty |= DIRTY_MODE;
+}
+
+// *****************************************************************************
+// ***   SetStepRamp   *********************************************************
+// *****************************************************************************
+void Application::SetStepRamp(ChannelType ch, uint64_t time_ms)
+{
+  // Zero means no ramp: move runs at frequency from the first step
+  if(time_ms > MAX_STEP_RAMP_MS) time_ms = MAX_STEP_RAMP_MS;
+  ch_dsc[ch].step_ramp_ms = time_ms;
+  // Mode strings should be redrawn
+  ch_dsc[ch].dirty |= DIRTY_MODE;
+}
+
+// *****************************************************************************
+// ***   SetStepStart   ********************************************************
+// *****************************************************************************
+void Application::SetStepStart(ChannelType ch, int64_t rate)
+{
+  if(rate < MIN_FREQ) rate = MIN_FREQ;
+  if(rate > MAX_PWM_STREAM_FREQ) rate = MAX_PWM_STREAM_FREQ;
+  ch_dsc[ch].step_start = rate;
+  // Mode strings should be redrawn
+  ch_dsc[ch].dirty |= DIRTY_MODE;
+}
+
+// *****************************************************************************
+// ***   SetBurstCycles   ******************************************************
+// *****************************************************************************
+void Application::SetBurstCycles(ChannelType ch, uint64_t cycles)
+{
+  if(cycles < 1U) cycles = 1U;
+  if(cycles > MAX_BURST_CYCLES) cycles = MAX_BURST_CYCLES;
+  ch_dsc[ch].burst_cycles = cycles;
+  // Mode strings should be redrawn
+  ch_dsc[ch].dirty |= DIRTY_MODE;
+}
+
+// *****************************************************************************
+// ***   SetBurstPeriod   ******************************************************
+// *****************************************************************************
+void Application::SetBurstPeriod(ChannelType ch, uint64_t period_ms)
+{
+  if(period_ms < MIN_BURST_PERIOD_MS) period_ms = MIN_BURST_PERIOD_MS;
+  if(period_ms > MAX_BURST_PERIOD_MS) period_ms = MAX_BURST_PERIOD_MS;
+  ch_dsc[ch].burst_period_ms = period_ms;
+  // Mode strings should be redrawn
+  ch_dsc[ch].dirty |= DIRTY_MODE;
+}
+
+// *****************************************************************************
+// ***   SetPrbsErrPeriod   ****************************************************
+// *****************************************************************************
+void Application::SetPrbsErrPeriod(ChannelType ch, uint64_t bits)
+{
+  // Zero disables error injection
+  if(bits > MAX_PRBS_ERR_PERIOD) bits = MAX_PRBS_ERR_PERIOD;
+  ch_dsc[ch].prbs_err_period = bits;
+  // Mode strings should be redrawn
+  ch_dsc[ch].dirty |= DIRTY_MODE;
+}
+
+// *****************************************************************************
+// ***   SetHopDwell   *********************************************************
+// *****************************************************************************
+void Application::SetHopDwell(ChannelType ch, uint64_t periods)
+{
+  if(periods < 1U) periods = 1U;
+  if(periods > MAX_HOP_DWELL) periods = MAX_HOP_DWELL;
+  ch_dsc[ch].hop_dwell = periods;
+  // Mode strings should be redrawn
+  ch_dsc[ch].dirty |= DIRTY_MODE;
+}
+
+// *****************************************************************************
+// ***   ProcessHopEntry   *****************************************************
+// *****************************************************************************
+void Application::ProcessHopEntry(Keypad::UnitType unit, uint64_t value)
+{
+  ChannelDescriptionType& dsc = ch_dsc[channel];
+  // Entered frequency in Hz, zero clears list
+  int64_t freq = -1;
+
+  switch(unit)
+  {
+    case Keypad::UNIT_HZ:
+      freq = value / 1000U;
+      break;
+
+    case Keypad::UNIT_KHZ:
+      freq = value;
+      break;
+
+    case Keypad::UNIT_MHZ:
+      freq = value * 1000U;
+      break;
+
+    case Keypad::UNIT_PERCENT:
+      // Duty of the last hop
+      if(dsc.hop_cnt > 0U)
+      {
+        int64_t duty = value * (DUTY_FULL / 100000);
+        if(duty < 1) duty = 1;
+        if(duty > GetMaxDuty(channel)) duty = GetMaxDuty(channel);
+        dsc.hops[dsc.hop_cnt - 1U].duty = duty;
+        dsc.hop_ver++;
+      }
+      break;
+
+    case Keypad::UNIT_CYCLES:
+      SetHopDwell(channel, value / 1000U);
+      break;
+
+    default: // Other units are not used by hop list
+      break;
+  }
+
+  if(freq == 0)
+  {
+    dsc.hop_cnt = 0U;
+    dsc.hop_ver++;
+  }
+  else if((freq > 0) && (dsc.hop_cnt < MAX_HOPS))
+  {
+    // New hop uses current duty of the channel
+    if(freq < MIN_FREQ) freq = MIN_FREQ;
+    if(freq > MAX_PWM_STREAM_FREQ) freq = MAX_PWM_STREAM_FREQ;
+    dsc.hops[dsc.hop_cnt].frequency = freq;
+    dsc.hops[dsc.hop_cnt].duty = dsc.duty;
+    dsc.hop_cnt++;
+    dsc.hop_ver++;
+  }
+  else
+  {
+    ; // Nothing to change
+  }
+  // Mode strings should be redrawn
+  dsc.dirty |= DIRTY_MODE;
+}
+
+// *****************************************************************************
+// ***   ProcessPatternEntry   *************************************************
+// *****************************************************************************
+void Application::ProcessPatternEntry(Keypad::UnitType unit, uint64_t value)
+{
+  // Entered word rate in Hz, zero stops output
+  int64_t rate = -1;
+
+  switch(unit)
+  {
+    case Keypad::UNIT_HZ:
+      rate = value / 1000U;
+      break;
+
+    case Keypad::UNIT_KHZ:
+      rate = value;
+      break;
+
+    case Keypad::UNIT_MHZ:
+      rate = value * 1000U;
+      break;
+
+    case Keypad::UNIT_CYCLES:
+      pattern_repeat = value / 1000U;
+      if(pattern_repeat < 1U) pattern_repeat = 1U;
+      if(pattern_repeat > MAX_PATTERN_REPEAT) pattern_repeat = MAX_PATTERN_REPEAT;
+      break;
+
+    case Keypad::ACTION_MODE:
+      pattern_mode = (PatternGen::ModeType)(pattern_mode + 1U);
+      if(pattern_mode >= PatternGen::MODE_CNT) pattern_mode = PatternGen::MODE_LOOP;
+      // Running output is restarted in new mode
+      if(pattern.IsRunning()) rate = pattern_rate;
+      break;
+
+    default: // Other units are not used by pattern generator
+      break;
+  }
+
+  if(rate == 0)
+  {
+    pattern.Stop();
+  }
+  else if(rate > 0)
+  {
+    pattern_rate = (rate > PatternGen::MAX_RATE) ? PatternGen::MAX_RATE : rate;
+    // Pattern received over USB has priority over file on SD card
+    if((pattern_mode != PatternGen::MODE_STREAM) && (pattern.GetLen() == 0U))
+    {
+      (void) pattern.LoadFile(PATTERN_FILE);
+    }
+    (void) pattern.Start(pattern_mode, pattern_rate, pattern_repeat, PATTERN_FILE);
+  }
+  else
+  {
+    ; // Nothing to start
+  }
+}
+
+// *****************************************************************************
+// ***   ProcessFrequencyChange   **********************************************
+// *****************************************************************************
+bool Application::ProcessFrequencyChange(int32_t steps)
+{
+  bool result = false;
+
+  // Scale steps by encoder rotation speed. Should be called every cycle to
+  // track rotation speed.
+  steps = freq_accel.Process(steps, RtosTick::GetTimeMs());
+
+  // Change Frequency
+  if(steps != 0)
+  {
+    int32_t freq = ch_dsc[channel].frequency;
+    int32_t max_freq = GetMaxFrequency(channel);
+    int32_t dir = (steps > 0) ? 1 : -1;
+    // Process each step separately, so accelerated steps still follow decade
+    // of the current frequency
+    for(int32_t i = 0; i != steps; i += dir)
+    {
+      // Find step size and decade limit
+      int32_t step = 100;
+      int32_t limit = 10000;
+      if(freq >= 1000000)
+      {
+        step = 100000;
+        limit = max_freq;
+      }
+      else if(freq >= 100000)
+      {
+        step = 10000;
+        limit = 1000000;
+      }
+      else if(freq >= 10000)
+      {
+        step = 1000;
+        limit = 100000;
+      }
+      // Change frequency
+      freq += dir * step;
+      if(freq > limit) freq = limit;
+      // Check absolute minimum
+      if(freq <= MIN_FREQ)
+      {
+        freq = MIN_FREQ;
+        break;
+      }
+      // Check absolute maximum
+      if(freq >= max_freq)
+      {
+        freq = max_freq;
+        break;
+      }
+    }
+    ch_dsc[channel].frequency = freq;
+    // Frequency string should be redrawn
+    ch_dsc[channel].dirty |= DIRTY_FREQ;
+    // Set flag for update
+    result = true;
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   ProcessDutyChange   ***************************************************
+// *****************************************************************************
+bool Application::ProcessDutyChange(int32_t steps)
+{
+  bool result = false;
+
+  // Change Frequency
+  if(steps != 0)
+  {
+    ChannelDescriptionType& dsc = ch_dsc[channel];
+    // Find maximum value
+    int32_t max_val = GetMaxDuty(channel);
+    int64_t duty = dsc.duty;
+    // Minimum value is one step of current resolution, wrap to 1 would give
+    // almost zero duty that is off the step grid
+    int64_t min_val = 1;
+    // Process amplitude/duty change, amplitude always in 1% steps
+    if(IsAnalogChannel(channel) || IsPwmDac(channel) || (dsc.duty_res == DUTY_RES_COARSE))
+    {
+      duty += (int64_t)steps * DUTY_STEP_COARSE;
+      min_val = DUTY_STEP_COARSE;
+    }
+    else if(dsc.duty_res == DUTY_RES_FINE)
+    {
+      duty += (int64_t)steps * DUTY_STEP_FINE;
+      min_val = DUTY_STEP_FINE;
+    }
+    else
+    {
+      // Move edge by counts of timer that outputs channel, TIM9 counts twice
+      // faster. Duty is rounded up, so it gives exactly this compare value.
+      uint32_t arr = GetChannelPwmClock(channel) / dsc.frequency - 1U;
+      int64_t ccr = (int64_t)DutyToCcr(arr, dsc.duty) + steps;
+      duty = (ccr * DUTY_FULL + arr) / (arr + 1U);
+      // One timer count
+      min_val = ((int64_t)DUTY_FULL + arr) / (arr + 1U);
+    }
+    if(duty < min_val) duty = max_val;
+    if(duty > max_val) duty = min_val;
+    dsc.duty = duty;
+    // Duty string should be redrawn
+    ch_dsc[channel].dirty |= DIRTY_DUTY;
+    // Set flag for update
+    result = true;
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   RequestApply   ********************************************************
+// *****************************************************************************
+void Application::RequestApply(uint8_t ch)
+{
+  ChannelDescriptionType& dsc = ch_dsc[ch];
+
+  // Parameters that matter for current mode are compared with applied ones
+  // and hashed into signature of the request. Hardware should be updated
+  // only if parameters are different.
+  uint32_t sig = APPLY_SIG_SEED;
+  bool pending = ParamChanged(sig, dsc.frequency, dsc.applied_frequency);
+  pending |= ParamChanged(sig, dsc.duty, dsc.applied_duty);
+  pending |= ParamChanged(sig, dsc.waveform, dsc.applied_waveform);
+  pending |= ParamChanged(sig, dsc.mode, dsc.applied_mode);
+  // Noise type matters only for noise
+  if(dsc.waveform == WAVEFORM_NOISE)
+  {
+    pending |= ParamChanged(sig, dsc.noise, dsc.applied_noise);
+  }
+  // Sweep parameters matter only in sweep mode
+  if(dsc.mode == MODE_SWEEP)
+  {
+    pending |= ParamChanged(sig, dsc.sweep_stop, dsc.applied_sweep_stop);
+    pending |= ParamChanged(sig, dsc.sweep_time_ms, dsc.applied_sweep_time_ms);
+    pending |= ParamChanged(sig, dsc.sweep_law, dsc.applied_sweep_law);
+    pending |= ParamChanged(sig, dsc.sweep_dir, dsc.applied_sweep_dir);
+  }
+  // Modulation parameters matter only in modulation modes
+  if(IsModulationMode(dsc.mode))
+  {
+    pending |= ParamChanged(sig, dsc.mod_shape, dsc.applied_mod_shape);
+    pending |= ParamChanged(sig, dsc.mod_rate, dsc.applied_mod_rate);
+    pending |= ParamChanged(sig, dsc.mod_depth, dsc.applied_mod_depth);
+  }
+  // Burst parameters matter only in burst mode
+  if(dsc.mode == MODE_BURST)
+  {
+    pending |= ParamChanged(sig, dsc.burst_cycles, dsc.applied_burst_cycles);
+    pending |= ParamChanged(sig, dsc.burst_period_ms, dsc.applied_burst_period_ms);
+  }
+  // PRBS parameters matter only in PRBS mode
+  if(dsc.mode == MODE_PRBS)
+  {
+    pending |= ParamChanged(sig, dsc.prbs, dsc.applied_prbs);
+    pending |= ParamChanged(sig, dsc.prbs_err_period, dsc.applied_prbs_err_period);
+  }
+  // Spread parameters matter only in spread mode, triangle uses modulation
+  // rate
+  if(dsc.mode == MODE_SPREAD)
+  {
+    pending |= ParamChanged(sig, dsc.spread_shape, dsc.applied_spread_shape);
+    pending |= ParamChanged(sig, dsc.spread, dsc.applied_spread);
+    if(dsc.spread_shape == SPREAD_TRIANGLE)
+    {
+      pending |= ParamChanged(sig, dsc.mod_rate, dsc.applied_mod_rate);
+    }
+  }
+  // Hop parameters matter only in hop mode, empty list uses sweep stop as
+  // second frequency
+  if(dsc.mode == MODE_HOP)
+  {
+    pending |= ParamChanged(sig, dsc.hop_dwell, dsc.applied_hop_dwell);
+    pending |= ParamChanged(sig, dsc.hop_ver, dsc.applied_hop_ver);
+    if(dsc.hop_cnt == 0U)
+    {
+      pending |= ParamChanged(sig, dsc.sweep_stop, dsc.applied_sweep_stop);
+    }
+  }
+  // Dead-time matters only for complementary output, re-arm request restores
+  // output after break
+  if(dsc.mode == MODE_COMPL)
+  {
+    pending |= ParamChanged(sig, dsc.dead_time_ns, dsc.applied_dead_time_ns);
+    pending |= ParamChanged(sig, dsc.compl_arm, dsc.applied_compl_arm);
+  }
+  // Phase count and spacing matter only for interleaved bank
+  if(dsc.mode == MODE_PHASE)
+  {
+    pending |= ParamChanged(sig, dsc.phase_cnt, dsc.applied_phase_cnt);
+    pending |= ParamChanged(sig, dsc.phase_spacing, dsc.applied_phase_spacing);
+  }
+  // Stepper parameters matter only in stepper mode, run request repeats move
+  if(dsc.mode == MODE_STEP)
+  {
+    pending |= ParamChanged(sig, dsc.step_cnt, dsc.applied_step_cnt);
+    pending |= ParamChanged(sig, dsc.step_profile, dsc.applied_step_profile);
+    pending |= ParamChanged(sig, dsc.step_ramp_ms, dsc.applied_step_ramp_ms);
+    pending |= ParamChanged(sig, dsc.step_start, dsc.applied_step_start);
+    pending |= ParamChanged(sig, dsc.step_dir, dsc.applied_step_dir);
+    pending |= ParamChanged(sig, dsc.step_run, dsc.applied_step_run);
+  }
+  // Trigger action matters only in continuous mode
+  if((dsc.mode == MODE_CONTINUOUS) && (dsc.waveform != WAVEFORM_NOISE))
+  {
+    pending |= ParamChanged(sig, dsc.trig, dsc.applied_trig);
+  }
+
+  // If previous request isn't applied yet, it is replaced by this one. It is
+  // dropped only if parameters are different: UI redraw of statistics
+  // requests the same parameters again.
+  if(!dsc.apply_pending)
+  {
+    dsc.apply_request_ms = RtosTick::GetTimeMs();
+  }
+  else if(sig != dsc.apply_sig)
+  {
+    dropped_updates++;
+  }
+  else
+  {
+    ; // Pending request is repeated
+  }
+  dsc.apply_pending = pending;
+  dsc.apply_sig = sig;
+}
+
+// *****************************************************************************
+// ***   ProcessApply   ********************************************************
+// *****************************************************************************
+void Application::ProcessApply(bool input_active)
+{
+  for(uint32_t i = 0U; i < CHANNEL_CNT; i++)
+  {
+    // Stepper move isn't cut: changes, including run request, are applied
+    // after its last step
+    if(ch_dsc[i].apply_pending && !IsStepMoving(i))
+    {
+      // While user rotates encoder, hardware update postponed, but not longer
+      // than APPLY_MAX_DELAY_MS to keep output follow the UI during sweep
+      if((input_active == false) || (RtosTick::GetTimeMs() - ch_dsc[i].apply_request_ms >= APPLY_MAX_DELAY_MS))
+      {
+        ApplyChannel(i);
+      }
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   ApplyChannel   ********************************************************
+// *****************************************************************************
+Result Application::ApplyChannel(uint8_t ch)
+{
+  Result result;
+
+  // Take latest parameters
+  ChannelDescriptionType& dsc = ch_dsc[ch];
+  int32_t frequency = dsc.frequency;
+  int32_t duty = dsc.duty;
+  WaveformType waveform = dsc.waveform;
+  ModeType mode = dsc.mode;
+  // Noise is always streamed, waveform of digital channels is never noise.
+  // PWM-DAC of digital channels is streamed too.
+  bool stream = (mode != MODE_CONTINUOUS) || (waveform == WAVEFORM_NOISE) || IsPwmDac(ch);
+  TrigType trig = stream ? TRIG_OFF : dsc.trig;
+
+  // Timer of slave channel is used by interleaved bank, parameters are applied
+  // after bank is stopped
+  if(IsPhaseSlave(ch))
+  {
+    dsc.apply_pending = false;
+    return Result::RESULT_OK;
+  }
+
+  // Trigger interrupt shouldn't touch hardware during reconfiguration
+  trigger[ch].action = TRIG_OFF;
+  // Stream of previous mode should be stopped before hardware reconfiguration
+  StopStream(ch);
+  // Complementary output and interleaved bank of previous mode should be
+  // stopped too
+  if((compl_ch == ch) && (mode != MODE_COMPL))
+  {
+    StopCompl();
+  }
+  if((ch == PHASE_CHANNEL) && phase_bank.active && (mode != MODE_PHASE))
+  {
+    StopPhaseBank();
+  }
+
+  // Each analog and digital channel is set up the same way on its own
+  // hardware
+  const ChannelHwType& hw = CHANNEL_HW[ch];
+  if(hw.analog)
+  {
+    if(!stream) result = SetupDac(hdac, hw.channel, *hw.htim, ch, frequency, duty, waveform, trig);
+    else        result = SetupDacStream(hdac, hw.channel, *hw.htim, ch);
+    ArmTrigger(ch, *hw.htim, hw.channel, trig);
+    UpdatePreview(ch, dac_data[CHANNEL_HW[ch].slot], dac_data_cnt[CHANNEL_HW[ch].slot]);
+  }
+  else
+  {
+    // Free running PWM is output by timer with finest edge step
+    bool hires = !stream && PlanPwmTimer(ch, frequency, trig);
+    if(hires)                        result = SetupHiresPwm(ch, frequency, duty);
+    else if(!stream)                 result = SetupPwm(*hw.htim, hw.channel, ch, frequency, duty, trig);
+    else if(mode == MODE_PRBS)       result = SetupPrbsStream(*hw.htim, hw.channel, ch);
+    else if(mode == MODE_DITHER)     result = SetupDitherStream(*hw.htim, hw.channel, ch);
+    else if(mode == MODE_HOP)        result = SetupHopStream(*hw.htim, hw.channel, ch);
+    else if(mode == MODE_COMPL)      result = SetupCompl(*hw.htim, hw.channel, ch);
+    else if(mode == MODE_PHASE)      result = SetupPhaseBank(ch);
+    else if(mode == MODE_STEP)       result = SetupStepStream(*hw.htim, hw.channel, ch);
+    else if(mode == MODE_CONTINUOUS) result = SetupPwmDac(*hw.htim, hw.channel, ch);
+    else                             result = SetupPwmStream(*hw.htim, hw.channel, ch);
+    ArmTrigger(ch, *hw.htim, hw.channel, trig);
+    // Pin returns to channel timer after it outputs new setup
+    if((hires_ch == ch) && !hires) StopHiresPwm();
+  }
+
+  // Store applied parameters
+  dsc.applied_frequency = frequency;
+  dsc.applied_duty = duty;
+  dsc.applied_waveform = waveform;
+  dsc.applied_noise = dsc.noise;
+  dsc.applied_mode = mode;
+  dsc.applied_sweep_stop = dsc.sweep_stop;
+  dsc.applied_sweep_time_ms = dsc.sweep_time_ms;
+  dsc.applied_sweep_law = dsc.sweep_law;
+  dsc.applied_sweep_dir = dsc.sweep_dir;
+  dsc.applied_mod_shape = dsc.mod_shape;
+  dsc.applied_mod_rate = dsc.mod_rate;
+  dsc.applied_mod_depth = dsc.mod_depth;
+  dsc.applied_burst_cycles = dsc.burst_cycles;
+  dsc.applied_burst_period_ms = dsc.burst_period_ms;
+  dsc.applied_prbs = dsc.prbs;
+  dsc.applied_prbs_err_period = dsc.prbs_err_period;
+  dsc.applied_hop_dwell = dsc.hop_dwell;
+  dsc.applied_spread_shape = dsc.spread_shape;
+  dsc.applied_spread = dsc.spread;
+  dsc.applied_dead_time_ns = dsc.dead_time_ns;
+  dsc.applied_compl_arm = dsc.compl_arm;
+  dsc.applied_phase_cnt = dsc.phase_cnt;
+  dsc.applied_phase_spacing = dsc.phase_spacing;
+  dsc.applied_step_cnt = dsc.step_cnt;
+  dsc.applied_step_profile = dsc.step_profile;
+  dsc.applied_step_ramp_ms = dsc.step_ramp_ms;
+  dsc.applied_step_start = dsc.step_start;
+  dsc.applied_step_dir = dsc.step_dir;
+  dsc.applied_step_run = dsc.step_run;
+  dsc.applied_hop_ver = dsc.hop_ver;
+  dsc.applied_trig = dsc.trig;
+  dsc.apply_pending = false;
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   UpdatePreview   *******************************************************
+// *****************************************************************************
+void Application::UpdatePreview(uint8_t ch, const uint16_t* dac_data, uint32_t dac_data_cnt)
+{
+  // Preview redraws itself only if decimated data is changed
+  if(ch_dsc[ch].preview.SetData(dac_data, dac_data_cnt, DAC_MAX_VAL))
+  {
+    update_pixels += ch_dsc[ch].preview.GetWidth() * ch_dsc[ch].preview.GetHeight();
+    display_drv.UpdateDisplay();
+  }
+}
+
+// *****************************************************************************
+// ***   GenerateWave   ********************************************************
+// *****************************************************************************
+Result Application::GenerateWave(uint16_t* dac_data, uint32_t dac_data_cnt, int32_t duty, WaveformType waveform)
+{
+  Result result;
+
+  uint32_t max_val = ((uint64_t)DAC_MAX_VAL * duty) / DUTY_FULL;
+  uint32_t shift = (DAC_MAX_VAL - max_val) / 2U;
+
+  switch(waveform)
+  {
+    case WAVEFORM_SINE:
+      for(uint32_t i = 0U; i < dac_data_cnt; i++)
+      {
+        dac_data[i] = (uint16_t)((sin((2.0F * i * PI) / (dac_data_cnt + 1)) + 1.0F) * max_val) >> 1U;
+        dac_data[i] += shift;
+      }
+      break;
+
+    case WAVEFORM_TRIANGLE:
+      for(uint32_t i = 0U; i < dac_data_cnt; i++)
+      {
+        if(i <= dac_data_cnt / 2U)
+        {
+          dac_data[i] = (max_val * i) / (dac_data_cnt / 2U);
+        }
+        else
+        {
+          dac_data[i] = (max_val * (dac_data_cnt - i)) / (dac_data_cnt / 2U);
+        }
+        dac_data[i] += shift;
+      }
+      break;
+
+    case WAVEFORM_SAWTOOTH:
+      for(uint32_t i = 0U; i < dac_data_cnt; i++)
+      {
+        dac_data[i] = (max_val * i) / (dac_data_cnt - 1U);
+        dac_data[i] += shift;
+      }
+      break;
+
+    case WAVEFORM_SQUARE:
+      for(uint32_t i = 0U; i < dac_data_cnt; i++)
+      {
+        dac_data[i] = (i < dac_data_cnt / 2U) ? max_val : 0x000;
+        dac_data[i] += shift;
+      }
+      break;
+
+    default:
+      result = Result::ERR_BAD_PARAMETER;
+      break;
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   GenerateLfo   *********************************************************
+// *****************************************************************************
+void Application::GenerateLfo(int16_t* lfo_data, uint32_t lfo_data_cnt, WaveformType waveform)
+{
+  // Full scale Q15 values
+  const int32_t amp = 32767;
+
+  for(uint32_t i = 0U; i < lfo_data_cnt; i++)
+  {
+    switch(waveform)
+    {
+      case WAVEFORM_SINE:
+        lfo_data[i] = (int16_t)(sin((2.0F * i * PI) / lfo_data_cnt) * amp);
+        break;
+
+      case WAVEFORM_TRIANGLE:
+        // Starts from zero as sine: 0 -> +1 -> -1 -> 0
+        if(i < lfo_data_cnt / 4U)          lfo_data[i] = (amp * 4 * (int32_t)i) / (int32_t)lfo_data_cnt;
+        else if(i < lfo_data_cnt * 3U / 4U) lfo_data[i] = amp - (amp * 4 * (int32_t)(i - lfo_data_cnt / 4U)) / (int32_t)lfo_data_cnt;
+        else                               lfo_data[i] = -amp + (amp * 4 * (int32_t)(i - lfo_data_cnt * 3U / 4U)) / (int32_t)lfo_data_cnt;
+        break;
+
+      case WAVEFORM_SAWTOOTH:
+        lfo_data[i] = -amp + (amp * 2 * (int32_t)i) / (int32_t)(lfo_data_cnt - 1U);
+        break;
+
+      case WAVEFORM_SQUARE:
+      default:
+        lfo_data[i] = (i < lfo_data_cnt / 2U) ? amp : -amp;
+        break;
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Setup DAC   ***********************************************************
+// *****************************************************************************
+Result Application::SetupDac(DAC_HandleTypeDef& hdac, uint32_t channel, TIM_HandleTypeDef& htim, uint8_t ch, uint32_t freq, int32_t duty, WaveformType waveform, TrigType trig)
+{
+  Result result;
+
+  uint16_t* data = dac_data[CHANNEL_HW[ch].slot];
+  uint32_t data_cnt = NumberOf(dac_data[CHANNEL_HW[ch].slot]);
+  uint32_t freq_sampling = 4000000U;
+
+  // Find sampling frequency
+  while(freq_sampling/freq > data_cnt) freq_sampling >>= 1U;
+  // Find count
+  data_cnt = freq_sampling/freq;
+  // Store count for the preview
+  dac_data_cnt[CHANNEL_HW[ch].slot] = data_cnt;
+  // Generate waveform
+  GenerateWave(data, data_cnt, duty, waveform);
+
+  // Stop timer
+  (void) HAL_TIM_Base_Stop(&htim);
+  // Stop DAC DMA
+  (void) HAL_DAC_Stop_DMA(&hdac, channel);
+  // DMA restarted by trigger interrupt isn't tracked by HAL, so stop it here
+  DMA_HandleTypeDef* hdma = CHANNEL_HW[ch].hdma;
+  __HAL_DMA_DISABLE(hdma);
+  while(hdma->Instance->CR & DMA_SxCR_EN);
+  // In step mode DMA transfers one period and trigger restarts it
+  if(trig == TRIG_STEP) hdma->Instance->CR &= ~DMA_SxCR_CIRC;
+  else                  hdma->Instance->CR |= DMA_SxCR_CIRC;
+  // Calculate ARR
+  uint16_t arr = ((HAL_RCC_GetPCLK1Freq() * 2U) / freq_sampling) - 1U;
+  // Prevent set to zero
+  if(arr < 20U) arr = 20U;
+  // Set period
+  htim.Instance->ARR = arr;
+  // Generate an update event
+  htim.Instance->EGR = TIM_EGR_UG;
+  // Start DAC DMA
+  (void) HAL_DAC_Start_DMA(&hdac, channel, (uint32_t*)data, data_cnt, DAC_ALIGN_12B_R);
+  // Start timer, in start and step modes it is started by trigger interrupt
+  if((trig != TRIG_START) && (trig != TRIG_STEP))
+  {
+    (void) HAL_TIM_Base_Start(&htim);
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Setup PWM   ***********************************************************
+// *****************************************************************************
+Result Application::SetupPwm(TIM_HandleTypeDef& htim, uint32_t channel, uint8_t ch, uint32_t freq, int32_t duty, TrigType trig)
+{
+  Result result;
+
+  if((duty > 0) && (duty < DUTY_FULL) && (channel <= TIM_CHANNEL_4))
+  {
+    // Triggered counter waits at zero. PWM mode 2 keeps output low until
+    // trigger, pulse is placed at the end of period.
+    bool triggered = (trig == TRIG_START) || (trig == TRIG_STEP);
+    // Period, counter counts ARR + 1 clocks
+    uint32_t arr = GetPwmArr(freq);
+    uint32_t ccr = DutyToCcr(arr, duty);
+    if(!triggered)
+    {
+      // Running PWM isn't restarted, new values take effect on update event
+      LoadPwm(htim, channel, arr, ccr);
+    }
+    else
+    {
+      // Last pulse is finished before counter is stopped
+      StopPwmAtUpdate(htim, channel);
+      // In step mode counter stops after one period until next trigger
+      if(trig == TRIG_STEP) htim.Instance->CR1 |= TIM_CR1_OPM;
+      else                  htim.Instance->CR1 &= ~TIM_CR1_OPM;
+      SetOcMode(htim.Instance, channel, TIM_OCMODE_PWM2);
+      htim.Instance->ARR = arr;
+      __HAL_TIM_SET_COMPARE(&htim, channel, arr + 1U - ccr);
+      // Counter is stopped, so update event doesn't cut anything
+      htim.Instance->EGR = TIM_EGR_UG;
+      // Clear update flag, it is used for latency measurement
+      htim.Instance->SR = 0U;
+      // TIM3 capture pulse starts counter in hardware
+      TIM_SlaveConfigTypeDef slave_cfg = {0};
+      slave_cfg.SlaveMode = TIM_SLAVEMODE_TRIGGER;
+      slave_cfg.InputTrigger = CHANNEL_HW[ch].trig_itr;
+      (void) HAL_TIM_SlaveConfigSynchro(&htim, &slave_cfg);
+      // HAL doesn't start counter in trigger mode
+      StartPwmOutput(htim, channel);
+    }
+  }
+  else
+  {
+    result = Result::ERR_BAD_PARAMETER;
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Setup DAC Stream   ****************************************************
+// *****************************************************************************
+Result Application::SetupDacStream(DAC_HandleTypeDef& hdac, uint32_t channel, TIM_HandleTypeDef& htim, uint8_t ch)
+{
+  Result result;
+
+  ChannelDescriptionType& dsc = ch_dsc[ch];
+  DdsType& dds_ch = dds[CHANNEL_HW[ch].slot];
+
+  // Stop timer
+  (void) HAL_TIM_Base_Stop(&htim);
+  // Stop DAC DMA
+  (void) HAL_DAC_Stop_DMA(&hdac, channel);
+  // Ping-pong buffer needs circular DMA, step trigger mode could disable it
+  DMA_HandleTypeDef* hdma = CHANNEL_HW[ch].hdma;
+  __HAL_DMA_DISABLE(hdma);
+  while(hdma->Instance->CR & DMA_SxCR_EN);
+  hdma->Instance->CR |= DMA_SxCR_CIRC;
+
+  // Ping-pong buffer uses beginning of DAC array, count stored for the preview
+  dds_ch.buf = dac_data[CHANNEL_HW[ch].slot];
+  dac_data_cnt[CHANNEL_HW[ch].slot] = DAC_STREAM_BLOCK * 2U;
+  dds_ch.waveform = dsc.waveform;
+  dds_ch.noise = dsc.noise;
+  if(dsc.waveform == WAVEFORM_NOISE)
+  {
+    // Span of raw noise values: 12-bit uniform, sum of 8 bytes for gaussian
+    // and sum of rows and white byte for pink
+    static const uint32_t NOISE_SPAN[NOISE_CNT] = {4096U, 8U * 255U + 1U, (PINK_ROWS + 1U) * 255U + 1U};
+    // Peak to peak amplitude and centering as for other waveforms
+    uint32_t max_val = ((uint64_t)DAC_MAX_VAL * dsc.duty) / DUTY_FULL;
+    dds_ch.noise_offset = (DAC_MAX_VAL - max_val) / 2U;
+    dds_ch.noise_scale = (max_val << 16U) / NOISE_SPAN[dsc.noise];
+    // Different seed for each channel, so channels aren't correlated. State
+    // kept between setups.
+    if(dds_ch.rng == 0U) dds_ch.rng = 2463534242U ^ ((ch + 1U) * 0x9E3779B9U);
+    // Random start values of pink rows, so output has no startup transient
+    dds_ch.pink_sum = 0U;
+    for(uint32_t i = 0U; i < PINK_ROWS; i++)
+    {
+      dds_ch.rng = Xorshift32(dds_ch.rng);
+      dds_ch.pink_rows[i] = dds_ch.rng >> 24U;
+      dds_ch.pink_sum += dds_ch.pink_rows[i];
+    }
+  }
+  else
+  {
+    // One period of waveform for DDS
+    result = GenerateWave(dds_ch.lut, NumberOf(dds_ch.lut), dsc.duty, dsc.waveform);
+  }
+  // Sweep stepped once per DAC block
+  dsc.sweep.Setup(dsc.frequency, dsc.sweep_stop, dsc.sweep_time_ms, dsc.sweep_law, dsc.sweep_dir, DAC_STREAM_BLOCK_US);
+  dds_ch.mode = dsc.mode;
+  dds_ch.phase = 0U;
+  dds_ch.phase_inc = (uint32_t)(dsc.sweep.GetFrequency() * DDS_PHASE_SCALE);
+  // Modulation LFO
+  GenerateLfo(dds_ch.lfo_lut, NumberOf(dds_ch.lfo_lut), dsc.mod_shape);
+  dds_ch.lfo_phase = 0U;
+  dds_ch.lfo_inc = (uint32_t)(dsc.mod_rate * DDS_PHASE_SCALE);
+  switch(dsc.mode)
+  {
+    case MODE_AM:
+      // Depth in Q15
+      dds_ch.mod_coef = (dsc.mod_depth * 32768) / 100;
+      break;
+
+    case MODE_FM:
+      // Frequency deviation in percents of carrier frequency
+      dds_ch.mod_coef = (int32_t)(((uint64_t)dds_ch.phase_inc * dsc.mod_depth) / 100U);
+      break;
+
+    case MODE_PM:
+      // Phase deviation, 100% is half of period(PI)
+      dds_ch.mod_coef = (int32_t)(((int64_t)INT32_MAX * dsc.mod_depth) / 100);
+      break;
+
+    default:
+      dds_ch.mod_coef = 0;
+      break;
+  }
+  // Burst starts from zero phase, between bursts output stays at level of
+  // the waveform start, so burst edges have no steps
+  dds_ch.burst_cycles = dsc.burst_cycles;
+  dds_ch.burst_samples = (uint32_t)(((uint64_t)DAC_STREAM_FS * dsc.burst_period_ms) / 1000U);
+  // Burst ends at phase overflow of its last cycle, at least one idle sample
+  // between bursts, so burst longer than its period isn't cut
+  uint64_t burst_len = (((uint64_t)dsc.burst_cycles << 32U) + dds_ch.phase_inc - 1U) / (dds_ch.phase_inc | 1U);
+  if(burst_len >= UINT32_MAX) dds_ch.burst_samples = UINT32_MAX;
+  else if(dds_ch.burst_samples <= burst_len) dds_ch.burst_samples = (uint32_t)burst_len + 1U;
+  dds_ch.burst_left = dsc.burst_cycles;
+  dds_ch.burst_pos = 0U;
+  dds_ch.idle_val = dds_ch.lut[0U];
+  // Fill both halves before start
+  for(uint32_t i = 0U; i < 2U; i++)
+  {
+    if(dds_ch.waveform == WAVEFORM_NOISE) FillNoiseBlock(ch, dds_ch.buf + i * DAC_STREAM_BLOCK);
+    else                                  FillDacBlock(ch, dds_ch.buf + i * DAC_STREAM_BLOCK);
+  }
+  // Allow DMA interrupts refill buffer
+  dds_ch.active = true;
+
+  // Set sampling period
+  htim.Instance->ARR = ((HAL_RCC_GetPCLK1Freq() * 2U) / DAC_STREAM_FS) - 1U;
+  // Generate an update event
+  htim.Instance->EGR = TIM_EGR_UG;
+  // Start DAC DMA, circular DMA gives half and full transfer interrupts
+  (void) HAL_DAC_Start_DMA(&hdac, channel, (uint32_t*)dds_ch.buf, DAC_STREAM_BLOCK * 2U, DAC_ALIGN_12B_R);
+  // Start timer
+  (void) HAL_TIM_Base_Start(&htim);
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Setup PWM Stream   ****************************************************
+// *****************************************************************************
+Result Application::SetupPwmStream(TIM_HandleTypeDef& htim, uint32_t channel, uint8_t ch)
+{
+  Result result;
+
+  ChannelDescriptionType& dsc = ch_dsc[ch];
+  PwmStreamType& stream = pwm_stream[CHANNEL_HW[ch].slot];
+
+  if((dsc.duty > 0) && (dsc.duty < DUTY_FULL) && (channel <= TIM_CHANNEL_4))
+  {
+    stream.htim = &htim;
+    stream.clk = GetPwmClock();
+    stream.duty = dsc.duty;
+    stream.duty_frac = DutyToFrac(stream.duty);
+    stream.mode = dsc.mode;
+    // Burst writes registers from ARR to CCRx: ARR, RCR, CCR1, ... CCRx.
+    // TIM_CHANNEL_x values are multiple of 4.
+    stream.ccr_idx = 2U + channel / 4U;
+    stream.burst_len = stream.ccr_idx + 1U;
+    stream.len = PWM_STREAM_LEN;
+    memset(stream.buf, 0, sizeof(stream.buf));
+    // Sweep stepped by elapsed timer counts
+    stream.step_cnt = (stream.clk / 1000000U) * PWM_STREAM_STEP_US;
+    stream.elapsed = 0U;
+    dsc.sweep.Setup(dsc.frequency, dsc.sweep_stop, dsc.sweep_time_ms, dsc.sweep_law, dsc.sweep_dir, PWM_STREAM_STEP_US);
+    SetPwmStreamFrequency(stream, dsc.sweep.GetFrequency());
+    // Burst repeat period in PWM periods, at least one idle period between
+    // bursts
+    stream.burst_cycles = dsc.burst_cycles;
+    stream.burst_periods = (uint32_t)(((uint64_t)stream.clk * dsc.burst_period_ms) / 1000U / (stream.arr + 1U));
+    if(stream.burst_periods <= stream.burst_cycles) stream.burst_periods = stream.burst_cycles + 1U;
+    stream.burst_pos = 0U;
+    // Spread: period around main frequency, deviation in timer counts and
+    // triangle phase increment per PWM period
+    if(stream.mode == MODE_SPREAD) SetPwmStreamFrequency(stream, dsc.frequency);
+    stream.spread_shape = dsc.spread_shape;
+    stream.spread_arr = stream.arr;
+    stream.spread_dev = ((uint64_t)(stream.arr + 1U) * dsc.spread) / 100U;
+    stream.spread_phase = 0U;
+    float spread_inc = 4294967296.0F * dsc.mod_rate * (stream.arr + 1U) / stream.clk;
+    stream.spread_inc = (spread_inc < 2147483648.0F) ? (uint32_t)spread_inc : 0x80000000U;
+    stream.rng = 0x2545F491U;
+    // Fill whole buffer before start
+    FillPwmBlock(ch, 0U, stream.len);
+    // First period, in burst mode it is idle period, so burst contains only
+    // periods from DMA buffer. Trigger input isn't used in streaming modes,
+    // so free running PWM is restored if needed. Values written by DMA on
+    // update event take effect only on the next update event and period is
+    // never cut.
+    LoadPwm(htim, channel, stream.arr, (stream.mode == MODE_BURST) ? 0U : stream.ccr);
+    // Allow DMA interrupts refill buffer
+    stream.active = true;
+    // Start DMA burst on every update event
+    (void) HAL_TIM_DMABurst_MultiWriteStart(&htim, TIM_DMABASE_ARR, TIM_DMA_UPDATE, stream.buf,
+                                            (stream.burst_len - 1U) << TIM_DCR_DBL_Pos, stream.len * stream.burst_len);
+  }
+  else
+  {
+    result = Result::ERR_BAD_PARAMETER;
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Setup PRBS Stream   ***************************************************
+// *****************************************************************************
+Result Application::SetupPrbsStream(TIM_HandleTypeDef& htim, uint32_t channel, uint8_t ch)
+{
+  Result result;
+
+  // PRBS polynomials x^order + x^tap + 1 (ITU-T O.150)
+  static const uint8_t PRBS_POLY[PRBS_CNT][2U] = {{7U, 6U}, {9U, 5U}, {15U, 14U}, {23U, 18U}, {31U, 28U}};
+
+  ChannelDescriptionType& dsc = ch_dsc[ch];
+  PwmStreamType& stream = pwm_stream[CHANNEL_HW[ch].slot];
+
+  if(channel <= TIM_CHANNEL_4)
+  {
+    stream.htim = &htim;
+    stream.clk = GetPwmClock();
+    stream.mode = MODE_PRBS;
+    // One bit per timer period
+    stream.arr = GetPrbsArr(dsc.frequency);
+    // Compare value above ARR keeps output high whole period
+    stream.ccr = stream.arr + 1U;
+    // DMA writes only CCRx, one word per bit
+    stream.burst_len = 1U;
+    stream.ccr_idx = 0U;
+    // LFSR starts from all ones
+    stream.lfsr_order = PRBS_POLY[dsc.prbs][0U];
+    stream.lfsr_tap = PRBS_POLY[dsc.prbs][1U];
+    stream.lfsr = (1U << stream.lfsr_order) - 1U;
+    stream.err_period = dsc.prbs_err_period;
+    stream.err_left = dsc.prbs_err_period;
+    // Short sequence without errors fits into buffer as whole periods, so
+    // circular DMA repeats it without refill
+    uint32_t period = (1U << stream.lfsr_order) - 1U;
+    bool refill = (period > NumberOf(stream.buf)) || (stream.err_period != 0U);
+    stream.len = refill ? NumberOf(stream.buf) : period * (NumberOf(stream.buf) / period);
+    FillPrbsBlock(ch, 0U, stream.len);
+    // Bit period, output is low until first bit. Preload registers, so bit
+    // written by DMA on update event is output whole next period.
+    LoadPwm(htim, channel, stream.arr, 0U);
+    // Allow DMA interrupts refill buffer
+    stream.active = true;
+    // Start DMA on every update event, one transfer to CCRx. TIM_CHANNEL_x
+    // values are multiple of 4.
+    (void) HAL_TIM_DMABurst_MultiWriteStart(&htim, TIM_DMABASE_CCR1 + channel / 4U, TIM_DMA_UPDATE, stream.buf,
+                                            TIM_DMABURSTLENGTH_1TRANSFER, stream.len);
+    if(!refill)
+    {
+      __HAL_DMA_DISABLE_IT(htim.hdma[TIM_DMA_ID_UPDATE], DMA_IT_HT | DMA_IT_TC);
+    }
+  }
+  else
+  {
+    result = Result::ERR_BAD_PARAMETER;
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Setup Dither Stream   *************************************************
+// *****************************************************************************
+Result Application::SetupDitherStream(TIM_HandleTypeDef& htim, uint32_t channel, uint8_t ch)
+{
+  Result result;
+
+  ChannelDescriptionType& dsc = ch_dsc[ch];
+  PwmStreamType& stream = pwm_stream[CHANNEL_HW[ch].slot];
+
+  if((dsc.duty > 0) && (dsc.duty < DUTY_FULL) && (channel <= TIM_CHANNEL_4))
+  {
+    stream.htim = &htim;
+    stream.clk = GetPwmClock();
+    stream.mode = MODE_DITHER;
+    stream.duty = dsc.duty;
+    // Period is fixed, only compare value changes
+    stream.arr = GetPwmArr(dsc.frequency);
+    uint32_t cnt = GetDitherCnt(stream.arr, stream.duty);
+    stream.ccr = cnt / DITHER_LEN;
+    // DMA writes only CCRx, one word per period
+    stream.burst_len = 1U;
+    stream.ccr_idx = 0U;
+    stream.len = DITHER_LEN;
+    // First order sigma-delta: period gets one count more when accumulated
+    // remainder overflows. Accumulator returns to start value at the end of
+    // sequence, so circular DMA repeats it without seam and refill.
+    uint32_t rem = cnt % DITHER_LEN;
+    uint32_t acc = DITHER_LEN / 2U;
+    for(uint32_t i = 0U; i < stream.len; i++)
+    {
+      acc += rem;
+      if(acc >= DITHER_LEN)
+      {
+        acc -= DITHER_LEN;
+        stream.buf[i] = stream.ccr + 1U;
+      }
+      else
+      {
+        stream.buf[i] = stream.ccr;
+      }
+    }
+    // Preload registers, so value written by DMA on update event is used
+    // whole next period
+    LoadPwm(htim, channel, stream.arr, stream.ccr);
+    stream.active = true;
+    // Start DMA on every update event, one transfer to CCRx. TIM_CHANNEL_x
+    // values are multiple of 4.
+    (void) HAL_TIM_DMABurst_MultiWriteStart(&htim, TIM_DMABASE_CCR1 + channel / 4U, TIM_DMA_UPDATE, stream.buf,
+                                            TIM_DMABURSTLENGTH_1TRANSFER, stream.len);
+    __HAL_DMA_DISABLE_IT(htim.hdma[TIM_DMA_ID_UPDATE], DMA_IT_HT | DMA_IT_TC);
+  }
+  else
+  {
+    result = Result::ERR_BAD_PARAMETER;
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Setup Hop Stream   ****************************************************
+// *****************************************************************************
+Result Application::SetupHopStream(TIM_HandleTypeDef& htim, uint32_t channel, uint8_t ch)
+{
+  Result result;
+
+  ChannelDescriptionType& dsc = ch_dsc[ch];
+  PwmStreamType& stream = pwm_stream[CHANNEL_HW[ch].slot];
+
+  if(channel <= TIM_CHANNEL_4)
+  {
+    stream.htim = &htim;
+    stream.clk = GetPwmClock();
+    stream.mode = MODE_HOP;
+    // Burst writes registers from ARR to CCRx: ARR, RCR, CCR1, ... CCRx.
+    // TIM_CHANNEL_x values are multiple of 4.
+    stream.ccr_idx = 2U + channel / 4U;
+    stream.burst_len = stream.ccr_idx + 1U;
+    memset(stream.buf, 0, sizeof(stream.buf));
+    // Period and compare values precomputed, so refill only copies them.
+    // Empty list is FSK between frequency and sweep stop frequency.
+    HopType fsk[2U] = {{dsc.frequency, dsc.duty}, {dsc.sweep_stop, dsc.duty}};
+    const HopType* hops = (dsc.hop_cnt == 0U) ? fsk : dsc.hops;
+    stream.hop_cnt = (dsc.hop_cnt == 0U) ? NumberOf(fsk) : dsc.hop_cnt;
+    for(uint32_t i = 0U; i < stream.hop_cnt; i++)
+    {
+      stream.duty = hops[i].duty;
+      SetPwmStreamFrequency(stream, hops[i].frequency);
+      stream.hop_arr[i] = stream.arr;
+      stream.hop_ccr[i] = stream.ccr;
+    }
+    // First period is loaded below and belongs to the first hop
+    stream.hop_dwell = dsc.hop_dwell;
+    stream.hop_idx = 0U;
+    stream.hop_left = stream.hop_dwell - 1U;
+    stream.arr = stream.hop_arr[0U];
+    stream.ccr = stream.hop_ccr[0U];
+    // Whole hop sequence that fits into buffer is repeated by circular DMA
+    // without refill, so hops are exact and CPU isn't used at all. Longer
+    // sequence is refilled by halves from DMA interrupt.
+    uint32_t total = stream.hop_cnt * stream.hop_dwell;
+    bool refill = (stream.hop_dwell > PWM_STREAM_LEN) || (total > PWM_STREAM_LEN);
+    stream.len = refill ? PWM_STREAM_LEN : total;
+    FillPwmBlock(ch, 0U, stream.len);
+    // Values written by DMA on update event take effect only on the next
+    // update event, so hop never cuts period
+    LoadPwm(htim, channel, stream.arr, stream.ccr);
+    // Allow DMA interrupts refill buffer
+    stream.active = true;
+    // Start DMA burst on every update event
+    (void) HAL_TIM_DMABurst_MultiWriteStart(&htim, TIM_DMABASE_ARR, TIM_DMA_UPDATE, stream.buf,
+                                            (stream.burst_len - 1U) << TIM_DCR_DBL_Pos, stream.len * stream.burst_len);
+    if(!refill)
+    {
+      __HAL_DMA_DISABLE_IT(htim.hdma[TIM_DMA_ID_UPDATE], DMA_IT_HT | DMA_IT_TC);
+    }
+  }
+  else
+  {
+    result = Result::ERR_BAD_PARAMETER;
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Setup Step Stream   ***************************************************
+// *****************************************************************************
+Result Application::SetupStepStream(TIM_HandleTypeDef& htim, uint32_t channel, uint8_t ch)
+{
+  Result result;
+
+  ChannelDescriptionType& dsc = ch_dsc[ch];
+  PwmStreamType& stream = pwm_stream[CHANNEL_HW[ch].slot];
+
+  if((dsc.duty > 0) && (dsc.duty < DUTY_FULL) && (channel <= TIM_CHANNEL_4))
+  {
+    stream.htim = &htim;
+    stream.clk = GetPwmClock();
+    stream.duty = dsc.duty;
+    stream.mode = MODE_STEP;
+    // Burst writes registers from ARR to CCRx: ARR, RCR, CCR1, ... CCRx.
+    // TIM_CHANNEL_x values are multiple of 4.
+    stream.ccr_idx = 2U + channel / 4U;
+    stream.burst_len = stream.ccr_idx + 1U;
+    stream.len = PWM_STREAM_LEN;
+    // Cruise rate is frequency, start rate above it means no ramp
+    float v1 = (dsc.frequency < MAX_PWM_STREAM_FREQ) ? dsc.frequency : MAX_PWM_STREAM_FREQ;
+    float v0 = (dsc.step_start < v1) ? dsc.step_start : v1;
+    float dv = v1 - v0;
+    float t = dsc.step_ramp_ms / 1000.0F;
+    SetPwmStreamFrequency(stream, v1);
+    stream.step_arr = stream.arr;
+    stream.step_ccr = stream.ccr;
+    // Distance of ramp in steps is average rate multiplied by ramp time for
+    // both profiles. Move shorter than two ramps never reaches cruise rate,
+    // it decelerates from the middle.
+    float ramp = (v0 + v1) * t / 2.0F;
+    stream.step_ramp = (dv > 0.0F) ? (uint32_t)ramp : 0U;
+    if(stream.step_ramp > 0U)
+    {
+      // Rate table is indexed by distance from the nearest end of move, so
+      // the same table serves acceleration and deceleration. Table holds
+      // periods, so refill doesn't divide.
+      stream.step_scale = (uint32_t)(STEP_LUT_LEN * 65536.0F / ramp);
+      float tk = 0.0F;
+      for(uint32_t k = 0U; k <= STEP_LUT_LEN; k++)
+      {
+        float pos = ramp * k / STEP_LUT_LEN;
+        if(dsc.step_profile == STEP_TRAPEZOID)
+        {
+          // Constant acceleration: v^2 = v0^2 + 2 * a * s
+          SetPwmStreamFrequency(stream, sqrtf(v0 * v0 + 2.0F * (dv / t) * pos));
+        }
+        else
+        {
+          // Rate v0 + dv * (1 - cos(pi * t / T)) / 2 has no closed form over
+          // distance, so time of each position is found by Newton's method
+          // starting from time of the previous entry
+          for(uint32_t j = 0U; j < 8U; j++)
+          {
+            float w = (float)PI * tk / t;
+            float sk = v0 * tk + dv * (tk - sinf(w) * t / (float)PI) / 2.0F;
+            float vk = v0 + dv * (1.0F - cosf(w)) / 2.0F;
+            tk -= (sk - pos) / vk;
+            if(tk < 0.0F) tk = 0.0F;
+            if(tk > t) tk = t;
+          }
+          SetPwmStreamFrequency(stream, v0 + dv * (1.0F - cosf((float)PI * tk / t)) / 2.0F);
+        }
+        stream.step_lut[k] = stream.arr;
+      }
+    }
+    stream.duty_frac = DutyToFrac(stream.duty);
+    // Output is low between moves: longest period keeps refill rare
+    SetPwmStreamFrequency(stream, MIN_FREQ);
+    stream.step_idle = stream.arr;
+    stream.step_total = dsc.step_cnt;
+    stream.step_idx = 0U;
+    // Direction is set before the first step, two idle periods at start rate
+    // give driver setup time
+    HAL_GPIO_WritePin(CHANNEL_HW[ch].dir_port, CHANNEL_HW[ch].dir_pin, dsc.step_dir ? GPIO_PIN_SET : GPIO_PIN_RESET);
+    FillPwmBlock(ch, 0U, stream.len);
+    SetPwmStreamFrequency(stream, v0);
+    LoadPwm(htim, channel, stream.arr, 0U);
+    // Allow DMA interrupts refill buffer
+    stream.active = true;
+    // Start DMA burst on every update event. Each step is one entry, so step
+    // count is exact and there is no per step interrupt: buffer is refilled
+    // by halves.
+    (void) HAL_TIM_DMABurst_MultiWriteStart(&htim, TIM_DMABASE_ARR, TIM_DMA_UPDATE, stream.buf,
+                                            (stream.burst_len - 1U) << TIM_DCR_DBL_Pos, stream.len * stream.burst_len);
+    // Short move fits into buffer with idle tail, refill isn't needed at all
+    if(stream.step_idx >= stream.step_total + stream.len)
+    {
+      __HAL_DMA_DISABLE_IT(htim.hdma[TIM_DMA_ID_UPDATE], DMA_IT_HT | DMA_IT_TC);
+    }
+  }
+  else
+  {
+    result = Result::ERR_BAD_PARAMETER;
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Setup PWM DAC   *******************************************************
+// *****************************************************************************
+Result Application::SetupPwmDac(TIM_HandleTypeDef& htim, uint32_t channel, uint8_t ch)
+{
+  Result result;
+
+  ChannelDescriptionType& dsc = ch_dsc[ch];
+  PwmStreamType& stream = pwm_stream[CHANNEL_HW[ch].slot];
+
+  if((dsc.frequency <= MAX_PWM_DAC_FREQ) && (channel <= TIM_CHANNEL_4))
+  {
+    stream.htim = &htim;
+    stream.clk = GetPwmClock();
+    stream.mode = MODE_CONTINUOUS;
+    stream.duty = dsc.duty;
+    // One sample per PWM period, PWM period is sample period
+    stream.len = GetPwmDacLen(dsc.frequency);
+    stream.arr = stream.clk / (dsc.frequency * stream.len) - 1U;
+    // DMA writes only CCRx, one word per sample
+    stream.burst_len = 1U;
+    stream.ccr_idx = 0U;
+    // DAC tables are used as is, DAC scale converted to timer counts. Compare
+    // value zero gives constant low level, so full range can be used.
+    result = GenerateWave(pwm_dac_data, stream.len, dsc.duty, dsc.waveform);
+    for(uint32_t i = 0U; i < stream.len; i++)
+    {
+      stream.buf[i] = (pwm_dac_data[i] * (stream.arr + 1U)) / (DAC_MAX_VAL + 1U);
+    }
+    // Preload registers, so sample written by DMA on update event is used
+    // whole next period
+    LoadPwm(htim, channel, stream.arr, stream.buf[0U]);
+    stream.active = true;
+    // Start DMA on every update event, one transfer to CCRx. TIM_CHANNEL_x
+    // values are multiple of 4. Table is whole period, so it is repeated by
+    // circular DMA without refill.
+    (void) HAL_TIM_DMABurst_MultiWriteStart(&htim, TIM_DMABASE_CCR1 + channel / 4U, TIM_DMA_UPDATE, stream.buf,
+                                            TIM_DMABURSTLENGTH_1TRANSFER, stream.len);
+    __HAL_DMA_DISABLE_IT(htim.hdma[TIM_DMA_ID_UPDATE], DMA_IT_HT | DMA_IT_TC);
+  }
+  else
+  {
+    result = Result::ERR_BAD_PARAMETER;
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Setup Complementary PWM   *********************************************
+// *****************************************************************************
+Result Application::SetupCompl(TIM_HandleTypeDef& htim, uint32_t channel, uint8_t ch)
+{
+  Result result = Result::ERR_BAD_PARAMETER;
+  ChannelDescriptionType& dsc = ch_dsc[ch];
+
+  if((dsc.duty > 0) && (dsc.duty < DUTY_FULL) && (dsc.frequency > 0) && (channel <= TIM_CHANNEL_4))
+  {
+    TIM_TypeDef* tim = htim1.Instance;
+    // Channel timer output isn't used, it stays low
+    StopPwmAtUpdate(htim, channel);
+    // TIM1 is 16-bit, prescaler extends period for low frequencies
+    uint32_t clk = GetComplClock();
+    uint32_t psc = (clk / dsc.frequency - 1U) >> 16U;
+    uint32_t arr = clk / ((psc + 1U) * dsc.frequency) - 1U;
+    uint32_t ccr = DutyToCcr(arr, dsc.duty);
+    // Dead-time generator counts timer clocks regardless of prescaler
+    uint32_t dt = 0U;
+    uint32_t dtg = DeadTimeToDtg(((uint64_t)dsc.dead_time_ns * clk) / 1000000000U, dt);
+
+    // Preload registers take effect on update event, so running output
+    // changes on period boundary. Update event is disabled while they are
+    // written, so no period gets new ARR with old CCR.
+    tim->CR1 |= TIM_CR1_UDIS;
+    tim->PSC = psc;
+    tim->ARR = arr;
+    tim->CCR1 = ccr;
+    tim->CR1 &= ~TIM_CR1_UDIS;
+    // Dead-time can be changed on the fly while lock level is off
+    MODIFY_REG(tim->BDTR, TIM_BDTR_DTG, dtg);
+
+    if((tim->CR1 & TIM_CR1_CEN) == 0U)
+    {
+      // Break input is taken from pattern generator while output is used
+      GPIO_InitTypeDef GPIO_InitStruct = {0};
+      GPIO_InitStruct.Pin = COMPL_BKIN_Pin;
+      GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+      GPIO_InitStruct.Pull = GPIO_PULLUP;
+      GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+      GPIO_InitStruct.Alternate = GPIO_AF1_TIM1;
+      HAL_GPIO_Init(COMPL_BKIN_GPIO_Port, &GPIO_InitStruct);
+      // Counter is stopped, so update event doesn't cut anything
+      tim->EGR = TIM_EGR_UG;
+      (void) HAL_TIM_PWM_Start(&htim1, TIM_CHANNEL_1);
+      (void) HAL_TIMEx_PWMN_Start(&htim1, TIM_CHANNEL_1);
+    }
+    // Break clears MOE and it stays cleared, any apply re-arms output. MOE
+    // can't be set while break input is still active.
+    __HAL_TIM_CLEAR_FLAG(&htim1, TIM_FLAG_BREAK);
+    __HAL_TIM_MOE_ENABLE(&htim1);
+    compl_ch = ch;
+    result = Result::RESULT_OK;
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Stop Complementary PWM   **********************************************
+// *****************************************************************************
+void Application::StopCompl()
+{
+  // Both outputs go to idle state immediately
+  __HAL_TIM_MOE_DISABLE_UNCONDITIONALLY(&htim1);
+  (void) HAL_TIMEx_PWMN_Stop(&htim1, TIM_CHANNEL_1);
+  (void) HAL_TIM_PWM_Stop(&htim1, TIM_CHANNEL_1);
+  // Break input pin is returned to pattern generator
+  HAL_GPIO_WritePin(COMPL_BKIN_GPIO_Port, COMPL_BKIN_Pin, GPIO_PIN_RESET);
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+  GPIO_InitStruct.Pin = COMPL_BKIN_Pin;
+  GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+  HAL_GPIO_Init(COMPL_BKIN_GPIO_Port, &GPIO_InitStruct);
+  compl_ch = CHANNEL_CNT;
+}
+
+// *****************************************************************************
+// ***   Setup High Resolution PWM   *******************************************
+// *****************************************************************************
+Result Application::SetupHiresPwm(uint8_t ch, uint32_t freq, int32_t duty)
+{
+  Result result;
+
+  const ChannelHwType& hw = CHANNEL_HW[ch];
+
+  if((duty > 0) && (duty < DUTY_FULL) && (hw.hires_htim != nullptr))
+  {
+    // Period, counter counts ARR + 1 clocks. Planner never selects APB2
+    // timer for period that doesn't fit 16-bit counter.
+    uint32_t arr = GetHiresClock() / freq - 1U;
+    // Running PWM isn't restarted, new values take effect on update event
+    LoadPwm(*hw.hires_htim, hw.hires_channel, arr, DutyToCcr(arr, duty));
+    if(hires_ch != ch)
+    {
+      // Pin is switched when TIM9 already outputs PWM, so output has no gap.
+      // Edges placed with ~6 ns step need the fastest pin.
+      SwitchPwmPin(ch, *hw.htim, hw.channel, *hw.hires_htim, hw.hires_channel, hw.hires_af, GPIO_SPEED_FREQ_VERY_HIGH);
+      hires_ch = ch;
+      // Pulse width and edge step depend on timer clock
+      ch_dsc[ch].dirty |= DIRTY_DUTY | DIRTY_MODE;
+    }
+  }
+  else
+  {
+    result = Result::ERR_BAD_PARAMETER;
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Stop High Resolution PWM   ********************************************
+// *****************************************************************************
+void Application::StopHiresPwm()
+{
+  if(hires_ch < CHANNEL_CNT)
+  {
+    const ChannelHwType& hw = CHANNEL_HW[hires_ch];
+    // Pin returns to channel timer with its initial configuration
+    SwitchPwmPin(hires_ch, *hw.hires_htim, hw.hires_channel, *hw.htim, hw.channel, hw.out_af, GPIO_SPEED_FREQ_LOW);
+    (void) HAL_TIM_PWM_Stop(hw.hires_htim, hw.hires_channel);
+    // Pulse width and edge step depend on timer clock
+    ch_dsc[hires_ch].dirty |= DIRTY_DUTY | DIRTY_MODE;
+    hires_ch = CHANNEL_CNT;
+  }
+}
+
+// *****************************************************************************
+// ***   Switch PWM Pin   ******************************************************
+// *****************************************************************************
+void Application::SwitchPwmPin(uint8_t ch, TIM_HandleTypeDef& from_htim, uint32_t from_channel,
+                               TIM_HandleTypeDef& to_htim, uint32_t to_channel, uint8_t af, uint32_t speed)
+{
+  const ChannelHwType& hw = CHANNEL_HW[ch];
+  TIM_TypeDef* from = from_htim.Instance;
+  TIM_TypeDef* to = to_htim.Instance;
+  uint32_t pos = POSITION_VAL(hw.out_pin);
+  volatile uint32_t& afr = hw.out_port->AFR[pos >> 3U];
+  uint32_t shift = (pos & 7U) * 4U;
+
+  // Slew rate change doesn't change output level
+  MODIFY_REG(hw.out_port->OSPEEDR, GPIO_OSPEEDER_OSPEEDR0 << (pos * 2U), speed << (pos * 2U));
+  // Outgoing edge-aligned PWM has low part from CCR to ARR. Stopped, one pulse
+  // or center-aligned timer is left as is, pin is switched at once.
+  uint32_t from_ccr = __HAL_TIM_GET_COMPARE(&from_htim, from_channel);
+  uint32_t from_arr = from->ARR;
+  bool now = !IsPwmFreeRunning(from, from_channel) || ((from->CR1 & TIM_CR1_CMS) != 0U) ||
+             (from_ccr > from_arr) || ((from_arr - from_ccr) < 2U * PWM_SWITCH_MARGIN);
+  bool reload = IsPwmFreeRunning(to, to_channel) && ((to->CR1 & TIM_CR1_CMS) == 0U);
+  bool done = false;
+  while(!done)
+  {
+    __disable_irq();
+    uint32_t cnt = from->CNT;
+    if(now || ((cnt >= from_ccr) && ((cnt - from_ccr) + PWM_SWITCH_MARGIN <= from_arr - from_ccr)))
+    {
+      // Incoming timer restarts at its falling edge, so it outputs its low
+      // part first. Update event loads its preload registers, but doesn't
+      // request stream DMA.
+      if(reload)
+      {
+        to->CR1 |= TIM_CR1_URS;
+        to->EGR = TIM_EGR_UG;
+        to->CR1 &= ~TIM_CR1_URS;
+        uint32_t to_ccr = __HAL_TIM_GET_COMPARE(&to_htim, to_channel);
+        if(to_ccr <= to->ARR) to->CNT = to_ccr;
+      }
+      MODIFY_REG(afr, 0xFU << shift, (uint32_t)af << shift);
+      done = true;
+    }
+    __enable_irq();
+  }
+}
+
+// *****************************************************************************
+// ***   PlanPwmTimer   ********************************************************
+// *****************************************************************************
+bool Application::PlanPwmTimer(uint8_t ch, uint32_t freq, TrigType trig)
+{
+  const ChannelHwType& hw = CHANNEL_HW[ch];
+
+  // APB2 timer has no DMA request and isn't started by trigger input, so it
+  // outputs only free running PWM. Its counter is shared by both channels.
+  bool result = (hw.hires_htim != nullptr) && (trig == TRIG_OFF) &&
+                ((hires_ch == CHANNEL_CNT) || (hires_ch == ch));
+  // 16-bit counter without prescaler counts twice more clocks per period
+  // than 32-bit counter of the channel. Prescaler would make its step the
+  // same or coarser, so low frequencies stay on the channel timer.
+  if(result)
+  {
+    uint32_t hires_cnt = GetHiresClock() / freq;
+    result = (hires_cnt <= 65536U) && (hires_cnt > GetPwmClock() / freq);
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   GetBurstPeriod   ******************************************************
+// *****************************************************************************
+uint32_t Application::GetBurstPeriod(uint8_t ch)
+{
+  const ChannelDescriptionType& dsc = ch_dsc[ch];
+  uint64_t rate;
+  uint64_t units;
+
+  // Burst with one idle unit after it: DAC samples of analog channel or PWM
+  // periods of digital channel
+  if(IsAnalogChannel(ch))
+  {
+    rate = DAC_STREAM_FS;
+    units = ((uint64_t)dsc.burst_cycles * DAC_STREAM_FS + (uint32_t)dsc.frequency - 1U) / (uint32_t)dsc.frequency + 1U;
+  }
+  else
+  {
+    rate = (uint32_t)dsc.frequency;
+    units = dsc.burst_cycles + 1U;
+  }
+  uint64_t min_ms = (units * 1000U + rate - 1U) / rate;
+
+  return (min_ms > dsc.burst_period_ms) ? (uint32_t)min_ms : dsc.burst_period_ms;
+}
+
+// *****************************************************************************
+// ***   IsStepMoving   ********************************************************
+// *****************************************************************************
+bool Application::IsStepMoving(uint8_t ch)
+{
+  bool result = false;
+
+  if(!IsAnalogChannel(ch) && (ch_dsc[ch].applied_mode == MODE_STEP))
+  {
+    const PwmStreamType& stream = pwm_stream[CHANNEL_HW[ch].slot];
+    result = stream.active && (stream.step_idx < stream.step_total + stream.len);
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   IsComplUsed   *********************************************************
+// *****************************************************************************
+bool Application::IsComplUsed(uint8_t ch)
+{
+  bool result = (compl_ch < CHANNEL_CNT) && (compl_ch != ch);
+
+  // Complementary output requested by other channel but not applied yet
+  for(uint32_t i = 0U; i < CHANNEL_CNT; i++)
+  {
+    if((i != ch) && (ch_dsc[i].mode == MODE_COMPL)) result = true;
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Setup Interleaved PWM Bank   ******************************************
+// *****************************************************************************
+Result Application::SetupPhaseBank(uint8_t ch)
+{
+  Result result = Result::ERR_BAD_PARAMETER;
+  ChannelDescriptionType& dsc = ch_dsc[ch];
+  // Master counter is timer of phase channel, slave channel timer is taken
+  const ChannelHwType& master = CHANNEL_HW[PHASE_CHANNEL];
+  const ChannelHwType& slave = CHANNEL_HW[PHASE_SLAVE_CHANNEL];
+  PhaseBankType plan;
+
+  bool planned = PlanPhases(dsc.phase_cnt, GetPhaseSpacing(dsc.phase_cnt, dsc.phase_spacing), plan);
+  // Counter runs up and down, so period is two ARR. TIM1 is 16-bit, prescaler
+  // extends period for low frequencies, other counters count at the same rate.
+  uint32_t half_cnt = GetPwmClock() / (2U * dsc.frequency);
+  plan.phase_cnt = dsc.phase_cnt;
+  plan.spacing = dsc.phase_spacing;
+  plan.psc = (plan.counters == PHASE_TIMER_CNT) ? ((half_cnt - 1U) >> 16U) : 0U;
+  plan.arr = half_cnt / (plan.psc + 1U);
+
+  if(planned && (dsc.duty > 0) && (dsc.duty < DUTY_FULL) && (plan.arr >= 2U) && (ch == PHASE_CHANNEL))
+  {
+    uint32_t ccr = DutyToCcr(plan.arr, dsc.duty);
+    uint32_t period = plan.arr * 2U;
+    // Counter starts up from value that puts its valley at phase angle.
+    // Counter in the second half of period would have to start down, so it
+    // starts half period later up and channel and partner swap PWM modes.
+    for(uint32_t i = 0U; i < plan.counters; i++)
+    {
+      uint32_t cnt = (period - (uint32_t)(((uint64_t)plan.angle[i] * period) / 360000U)) % period;
+      plan.swap[i] = (cnt > plan.arr);
+      plan.start[i] = plan.swap[i] ? (cnt - plan.arr) : cnt;
+    }
+
+    if(phase_bank.active && (plan.phase_cnt == phase_bank.phase_cnt) && (plan.spacing == phase_bank.spacing) &&
+       (plan.psc == phase_bank.psc) && (plan.arr == phase_bank.arr))
+    {
+      // Only duty is changed: compare preload of each output is loaded at
+      // update event between its pulses, so no pulse is cut
+      for(uint32_t i = 0U; i < phase_bank.counters; i++)
+      {
+        LoadPhaseCompare(i, ccr);
+      }
+    }
+    else
+    {
+      if(phase_bank.active)
+      {
+        // All outputs are low when master stops and gated slaves freeze with
+        // it, so all phases are retimed together without runt pulses
+        HaltPhaseBank();
+      }
+      else
+      {
+        // Slave channel output is taken: its trigger, stream and
+        // complementary output are stopped
+        trigger[PHASE_SLAVE_CHANNEL].action = TRIG_OFF;
+        StopStream(PHASE_SLAVE_CHANNEL);
+        if(compl_ch == PHASE_SLAVE_CHANNEL) StopCompl();
+        StopPwmAtUpdate(*slave.htim, slave.channel);
+        if(hires_ch == PHASE_SLAVE_CHANNEL) StopHiresPwm();
+        StopPwmAtUpdate(*master.htim, master.channel);
+        // Slave channel shows that it is taken
+        ch_dsc[PHASE_SLAVE_CHANNEL].dirty |= DIRTY_MODE;
+        update = true;
+      }
+      // Counters unused by new plan are stopped with outputs low
+      for(uint32_t i = plan.counters; i < phase_bank.counters; i++)
+      {
+        StopPhaseCounter(i);
+      }
+      phase_bank = plan;
+      // Master output trigger is high while master counter is enabled, so
+      // update event of master setup doesn't pulse it
+      MODIFY_REG(master.htim->Instance->CR2, TIM_CR2_MMS, TIM_TRGO_ENABLE);
+      // Slaves first: gated slave is enabled, but counts only while master
+      // counter is enabled
+      for(uint32_t i = phase_bank.counters; i > 0U; i--)
+      {
+        SetupPhaseCounter(i - 1U, ccr);
+      }
+      // Master starts all counters at once
+      StartPwmOutput(*master.htim, master.channel);
+      master.htim->Instance->CR1 |= TIM_CR1_CEN;
+      // Peak outputs start after the first valley of their counter
+      for(uint32_t i = 0U; i < phase_bank.counters; i++)
+      {
+        LoadPhaseCompare(i, ccr);
+      }
+    }
+    phase_bank.active = true;
+    result = Result::RESULT_OK;
+  }
+  else if(phase_bank.active)
+  {
+    // Output stays low until phases fit into counters
+    StopPhaseBank();
+    StopPwmAtUpdate(*master.htim, master.channel);
+  }
+  else
+  {
+    StopPwmAtUpdate(*master.htim, master.channel);
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Setup Interleaved PWM Bank Counter   **********************************
+// *****************************************************************************
+void Application::SetupPhaseCounter(uint32_t idx, uint32_t ccr)
+{
+  const PhaseTimerType& pt = phase_timers[idx];
+  TIM_TypeDef* tim = pt.htim->Instance;
+
+  // Center-aligned mode can be set only while counter is disabled. Counter
+  // direction is up after edge-aligned mode.
+  tim->CR1 = TIM_CR1_ARPE;
+  tim->SMCR = (idx == 0U) ? 0U : (pt.ts | TIM_SLAVEMODE_GATED);
+  // APB2 timer clock is faster, prescaler is scaled to the same count rate
+  tim->PSC = pt.apb2 ? ((phase_bank.psc + 1U) * (GetComplClock() / GetPwmClock()) - 1U) : phase_bank.psc;
+  tim->ARR = phase_bank.arr;
+  SetOcMode(tim, pt.channel, phase_bank.swap[idx] ? TIM_OCMODE_PWM2 : TIM_OCMODE_PWM1);
+  SetOcMode(tim, pt.partner, phase_bank.swap[idx] ? TIM_OCMODE_PWM1 : TIM_OCMODE_PWM2);
+  __HAL_TIM_ENABLE_OCxPRELOAD(pt.htim, pt.channel);
+  __HAL_TIM_ENABLE_OCxPRELOAD(pt.htim, pt.partner);
+  // Update event loads compare values that never activate outputs, so start
+  // value inside pulse doesn't output part of it. Counter starts up and valley
+  // output gets its value at the first peak, peak output after master start.
+  uint32_t valley = phase_bank.swap[idx] ? pt.partner : pt.channel;
+  uint32_t peak = phase_bank.swap[idx] ? pt.channel : pt.partner;
+  __HAL_TIM_SET_COMPARE(pt.htim, valley, 0U);
+  __HAL_TIM_SET_COMPARE(pt.htim, peak, phase_bank.arr);
+  tim->EGR = TIM_EGR_UG;
+  __HAL_TIM_SET_COMPARE(pt.htim, valley, ccr);
+  tim->CNT = phase_bank.start[idx];
+  tim->CR1 |= TIM_CR1_CMS_0;
+  // Channel output is always used, partner only if it outputs a phase.
+  // Channel of digital channel timer is never disabled directly, HAL keeps
+  // its state.
+  tim->CCER |= (TIM_CCER_CC1E << pt.channel);
+  if(phase_bank.used[idx] & 2U) tim->CCER |= (TIM_CCER_CC1E << pt.partner);
+  else                          tim->CCER &= ~(TIM_CCER_CC1E << pt.partner);
+  if(pt.apb2)
+  {
+    // Break input is pattern generator output now
+    tim->BDTR &= ~TIM_BDTR_BKE;
+    tim->BDTR |= TIM_BDTR_MOE;
+  }
+  // Master partner pin is taken from pattern generator only if it is used
+  if(idx == 0U)
+  {
+    SetPhasePartnerPin((phase_bank.used[idx] & 2U) != 0U);
+  }
+  // Gated slave is enabled, master is enabled last
+  if(idx != 0U)
+  {
+    tim->CR1 |= TIM_CR1_CEN;
+  }
+}
+
+// *****************************************************************************
+// ***   Load Interleaved PWM Bank Compare Values   ****************************
+// *****************************************************************************
+void Application::LoadPhaseCompare(uint32_t idx, uint32_t ccr)
+{
+  const PhaseTimerType& pt = phase_timers[idx];
+
+  // PWM mode 1 pulse is 2 * CCR counts around valley, PWM mode 2 pulse is
+  // 2 * (ARR - CCR) counts around peak. Valley output is loaded at peak and
+  // peak output at valley, so each pulse is output whole with old or new
+  // width. CCR 0 and ARR never activate outputs.
+  uint32_t valley = phase_bank.swap[idx] ? pt.partner : pt.channel;
+  uint32_t peak = phase_bank.swap[idx] ? pt.channel : pt.partner;
+  WritePhaseCompare(idx, valley, ccr, false);
+  WritePhaseCompare(idx, peak, phase_bank.arr - ccr, true);
+}
+
+// *****************************************************************************
+// ***   Write Interleaved PWM Bank Compare Preload   **************************
+// *****************************************************************************
+void Application::WritePhaseCompare(uint32_t idx, uint32_t channel, uint32_t ccr, bool down)
+{
+  TIM_TypeDef* tim = phase_timers[idx].htim->Instance;
+
+  // Stopped bank loads preload at start. Half period shorter than two margins
+  // leaves no time to write, value is written at once then.
+  bool done = ((CHANNEL_HW[PHASE_CHANNEL].htim->Instance->CR1 & TIM_CR1_CEN) == 0U) || (phase_bank.arr < 2U * PHASE_WRITE_MARGIN);
+  if(done)
+  {
+    __HAL_TIM_SET_COMPARE(phase_timers[idx].htim, channel, ccr);
+  }
+  while(!done)
+  {
+    // Counter is read before direction: if it turns between reads, counter
+    // is near turning point and write is refused
+    __disable_irq();
+    uint32_t cnt = tim->CNT;
+    bool cnt_down = ((tim->CR1 & TIM_CR1_DIR) != 0U);
+    if((cnt_down == down) && (down ? (cnt >= PHASE_WRITE_MARGIN) : (cnt + PHASE_WRITE_MARGIN <= phase_bank.arr)))
+    {
+      __HAL_TIM_SET_COMPARE(phase_timers[idx].htim, channel, ccr);
+      done = true;
+    }
+    __enable_irq();
+  }
+}
+
+// *****************************************************************************
+// ***   Halt Interleaved PWM Bank   *******************************************
+// *****************************************************************************
+void Application::HaltPhaseBank()
+{
+  for(uint32_t i = 0U; i < phase_bank.counters; i++)
+  {
+    // Peak output value is written while counting down, counter counts up
+    // after valley that loads it. Valley output value is loaded at peak
+    // before it.
+    LoadPhaseCompare(i, 0U);
+    while(phase_timers[i].htim->Instance->CR1 & TIM_CR1_DIR);
+  }
+  // All outputs are low, gated slaves freeze with master
+  CHANNEL_HW[PHASE_CHANNEL].htim->Instance->CR1 &= ~TIM_CR1_CEN;
+}
+
+// *****************************************************************************
+// ***   Stop Interleaved PWM Bank   *******************************************
+// *****************************************************************************
+void Application::StopPhaseBank()
+{
+  // Master stops with all outputs low, gated slaves freeze with it
+  HaltPhaseBank();
+  CHANNEL_HW[PHASE_CHANNEL].htim->Instance->CR2 &= ~TIM_CR2_MMS;
+
+  for(uint32_t i = 0U; i < phase_bank.counters; i++)
+  {
+    StopPhaseCounter(i);
+  }
+  phase_bank.active = false;
+  phase_bank.counters = 0U;
+
+  // Slave channel gets its own parameters back
+  ch_dsc[PHASE_SLAVE_CHANNEL].applied_mode = MODE_CNT;
+  RequestApply(PHASE_SLAVE_CHANNEL);
+  ch_dsc[PHASE_SLAVE_CHANNEL].dirty |= DIRTY_MODE;
+  update = true;
+}
+
+// *****************************************************************************
+// ***   Stop Interleaved PWM Bank Counter   ***********************************
+// *****************************************************************************
+void Application::StopPhaseCounter(uint32_t idx)
+{
+  const PhaseTimerType& pt = phase_timers[idx];
+  TIM_TypeDef* tim = pt.htim->Instance;
+
+  // Channel output of digital channel timer is forced low. Swapped counter
+  // has compare value at ARR for peak output, so zero compare value is loaded
+  // by update event below and PWM mode 1 keeps output low until channel setup.
+  if(!pt.apb2)
+  {
+    SetOcMode(tim, pt.channel, TIM_OCMODE_FORCED_INACTIVE);
+    __HAL_TIM_SET_COMPARE(pt.htim, pt.channel, 0U);
+  }
+  // Counter is returned to edge-aligned mode without prescaler
+  tim->CR1 = TIM_CR1_ARPE;
+  tim->SMCR = 0U;
+  tim->PSC = 0U;
+  tim->EGR = TIM_EGR_UG;
+  // Partner and TIM1 outputs are disabled
+  tim->CCER &= ~(TIM_CCER_CC1E << pt.partner);
+  if(idx == 0U)
+  {
+    SetPhasePartnerPin(false);
+  }
+  if(pt.apb2)
+  {
+    tim->CCER &= ~(TIM_CCER_CC1E << pt.channel);
+    tim->BDTR |= TIM_BDTR_BKE;
+  }
+  else
+  {
+    SetOcMode(tim, pt.channel, TIM_OCMODE_PWM1);
+  }
+}
+
+// *****************************************************************************
+// ***   Set Interleaved PWM Bank Partner Pin   ********************************
+// *****************************************************************************
+void Application::SetPhasePartnerPin(bool bank)
+{
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+  GPIO_InitStruct.Pin = PHASE_TIM2_OUT_Pin;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  if(bank)
+  {
+    GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+    GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+    GPIO_InitStruct.Alternate = GPIO_AF1_TIM2;
+  }
+  else
+  {
+    // Pattern generator configuration, pin level is pattern bit from ODR
+    GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+    GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+  }
+  HAL_GPIO_Init(PHASE_TIM2_OUT_GPIO_Port, &GPIO_InitStruct);
+}
+
+// *****************************************************************************
+// ***   PlanPhases   **********************************************************
+// *****************************************************************************
+bool Application::PlanPhases(uint8_t cnt, uint32_t spacing, PhaseBankType& plan)
+{
+  bool result = true;
+
+  plan.counters = 0U;
+  for(uint32_t k = 0U; (k < cnt) && result; k++)
+  {
+    // Phase lag of phase k in millidegrees
+    uint32_t angle = (k * spacing) % 360000U;
+    // Look for used counter with free partner half period away
+    uint32_t i = 0U;
+    while((i < plan.counters) && (((plan.angle[i] + 180000U) % 360000U != angle) || (plan.used[i] & 2U)))
+    {
+      i++;
+    }
+    if(i < plan.counters)
+    {
+      plan.used[i] |= 2U;
+      plan.out[k] = i * 2U + 1U;
+    }
+    else if(plan.counters < PHASE_TIMER_CNT)
+    {
+      plan.angle[i] = angle;
+      plan.used[i] = 1U;
+      plan.out[k] = i * 2U;
+      plan.counters++;
+    }
+    else
+    {
+      result = false;
+    }
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Stop Stream   *********************************************************
+// *****************************************************************************
+void Application::StopStream(uint8_t ch)
+{
+  if(IsAnalogChannel(ch))
+  {
+    // DAC DMA stopped by DAC setup, just stop refill
+    dds[CHANNEL_HW[ch].slot].active = false;
+  }
+  else
+  {
+    PwmStreamType& stream = pwm_stream[CHANNEL_HW[ch].slot];
+    if(stream.active)
+    {
+      stream.active = false;
+      (void) HAL_TIM_DMABurst_WriteStop(stream.htim, TIM_DMA_UPDATE);
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   FillDacBlock   ********************************************************
+// *****************************************************************************
+void Application::FillDacBlock(uint8_t ch, uint16_t* buf)
+{
+  uint32_t start_cycles = DWT->CYCCNT;
+
+  DdsType& dds_ch = dds[CHANNEL_HW[ch].slot];
+  // Local copies allows compiler keep everything in registers
+  const uint16_t* lut = dds_ch.lut;
+  const int16_t* lfo_lut = dds_ch.lfo_lut;
+  uint32_t phase = dds_ch.phase;
+  uint32_t phase_inc = dds_ch.phase_inc;
+  uint32_t lfo_phase = dds_ch.lfo_phase;
+  uint32_t lfo_inc = dds_ch.lfo_inc;
+  int32_t coef = dds_ch.mod_coef;
+
+  // Separate loop for each mode to keep per sample work minimal
+  switch(dds_ch.mode)
+  {
+    case MODE_AM:
+      for(uint32_t i = 0U; i < DAC_STREAM_BLOCK; i++)
+      {
+        int32_t lfo = lfo_lut[lfo_phase >> LFO_LUT_SHIFT];
+        // Gain in Q15 changes from 1 - depth to 1
+        int32_t gain = 32768 - ((coef * ((32768 - lfo) >> 1U)) >> 15U);
+        buf[i] = DAC_MID_VAL + (((lut[phase >> DDS_LUT_SHIFT] - DAC_MID_VAL) * gain) >> 15U);
+        phase += phase_inc;
+        lfo_phase += lfo_inc;
+      }
+      break;
+
+    case MODE_FM:
+      for(uint32_t i = 0U; i < DAC_STREAM_BLOCK; i++)
+      {
+        int32_t lfo = lfo_lut[lfo_phase >> LFO_LUT_SHIFT];
+        buf[i] = lut[phase >> DDS_LUT_SHIFT];
+        phase += phase_inc + (int32_t)(((int64_t)coef * lfo) >> 15U);
+        lfo_phase += lfo_inc;
+      }
+      break;
+
+    case MODE_PM:
+      for(uint32_t i = 0U; i < DAC_STREAM_BLOCK; i++)
+      {
+        int32_t lfo = lfo_lut[lfo_phase >> LFO_LUT_SHIFT];
+        buf[i] = lut[(phase + (int32_t)(((int64_t)coef * lfo) >> 15U)) >> DDS_LUT_SHIFT];
+        phase += phase_inc;
+        lfo_phase += lfo_inc;
+      }
+      break;
+
+    case MODE_BURST:
+    {
+      uint32_t left = dds_ch.burst_left;
+      uint32_t pos = dds_ch.burst_pos;
+      for(uint32_t i = 0U; i < DAC_STREAM_BLOCK; i++)
+      {
+        if(left > 0U)
+        {
+          buf[i] = lut[phase >> DDS_LUT_SHIFT];
+          uint32_t next_phase = phase + phase_inc;
+          // Phase overflow is end of cycle
+          if(next_phase < phase) left--;
+          phase = next_phase;
+        }
+        else
+        {
+          buf[i] = dds_ch.idle_val;
+        }
+        // Start of next burst
+        pos++;
+        if(pos >= dds_ch.burst_samples)
+        {
+          pos = 0U;
+          phase = 0U;
+          left = dds_ch.burst_cycles;
+        }
+      }
+      dds_ch.burst_left = left;
+      dds_ch.burst_pos = pos;
+      break;
+    }
+
+    default:
+      for(uint32_t i = 0U; i < DAC_STREAM_BLOCK; i++)
+      {
+        buf[i] = lut[phase >> DDS_LUT_SHIFT];
+        phase += phase_inc;
+      }
+      break;
+  }
+  dds_ch.phase = phase;
+  dds_ch.lfo_phase = lfo_phase;
+
+  // Next block uses next sweep frequency
+  if(dds_ch.mode == MODE_SWEEP)
   {
-    result = Result::ERR_BAD_PARAMETER;
+    dds_ch.phase_inc = (uint32_t)(ch_dsc[ch].sweep.Step() * DDS_PHASE_SCALE);
+  }
+
+  dds_ch.fill_cycles = DWT->CYCCNT - start_cycles;
+}
+
+// *****************************************************************************
+// ***   FillNoiseBlock   ******************************************************
+// *****************************************************************************
+void Application::FillNoiseBlock(uint8_t ch, uint16_t* buf)
+{
+  uint32_t start_cycles = DWT->CYCCNT;
+
+  DdsType& dds_ch = dds[CHANNEL_HW[ch].slot];
+  // Local copies allows compiler keep everything in registers
+  uint32_t x = dds_ch.rng;
+  uint32_t scale = dds_ch.noise_scale;
+  uint32_t offset = dds_ch.noise_offset;
+
+  // Separate loop for each noise type to keep per sample work minimal
+  switch(dds_ch.noise)
+  {
+    case NOISE_GAUSS:
+      for(uint32_t i = 0U; i < DAC_STREAM_BLOCK; i++)
+      {
+        // Sum of 8 uniform bytes approximates gaussian distribution, peaks
+        // are limited to +/-4.9 sigma. USAD8 sums 4 bytes in one cycle.
+        x = Xorshift32(x);
+        uint32_t sum = __USAD8(x, 0U);
+        x = Xorshift32(x);
+        sum = __USADA8(x, 0U, sum);
+        buf[i] = offset + ((sum * scale) >> 16U);
+      }
+      break;
+
+    case NOISE_PINK:
+    {
+      uint8_t* rows = dds_ch.pink_rows;
+      uint32_t sum = dds_ch.pink_sum;
+      uint32_t cnt = dds_ch.pink_cnt;
+      for(uint32_t i = 0U; i < DAC_STREAM_BLOCK; i++)
+      {
+        x = Xorshift32(x);
+        // Voss-McCartney: row to update is count of trailing zeros of sample
+        // counter, so row N is updated every 2^(N+1) samples
+        uint32_t row = __CLZ(__RBIT(cnt | (1U << (PINK_ROWS - 1U))));
+        sum += (x >> 24U) - rows[row];
+        rows[row] = x >> 24U;
+        cnt++;
+        // White component from low byte of the same random value
+        buf[i] = offset + (((sum + (x & 0xFFU)) * scale) >> 16U);
+      }
+      dds_ch.pink_sum = sum;
+      dds_ch.pink_cnt = cnt;
+      break;
+    }
+
+    default:
+      for(uint32_t i = 0U; i < DAC_STREAM_BLOCK; i++)
+      {
+        x = Xorshift32(x);
+        buf[i] = offset + (((x >> 20U) * scale) >> 16U);
+      }
+      break;
+  }
+  dds_ch.rng = x;
+
+  dds_ch.fill_cycles = DWT->CYCCNT - start_cycles;
+}
+
+// *****************************************************************************
+// ***   FillPwmBlock   ********************************************************
+// *****************************************************************************
+void Application::FillPwmBlock(uint8_t ch, uint32_t start, uint32_t cnt)
+{
+  uint32_t start_cycles = DWT->CYCCNT;
+
+  PwmStreamType& stream = pwm_stream[CHANNEL_HW[ch].slot];
+  uint32_t* ptr = &stream.buf[start * stream.burst_len];
+
+  for(uint32_t i = 0U; i < cnt; i++)
+  {
+    // Hop: next values from precomputed list after given count of periods
+    if(stream.mode == MODE_HOP)
+    {
+      if(stream.hop_left == 0U)
+      {
+        stream.hop_idx++;
+        if(stream.hop_idx >= stream.hop_cnt) stream.hop_idx = 0U;
+        stream.arr = stream.hop_arr[stream.hop_idx];
+        stream.ccr = stream.hop_ccr[stream.hop_idx];
+        stream.hop_left = stream.hop_dwell;
+      }
+      stream.hop_left--;
+    }
+    // Stepper: period from ramp table by distance from the nearest end of
+    // move or cruise period, then idle periods without pulse. Integer
+    // interpolation and compare from duty fraction, refill time is in
+    // fill_cycles.
+    if(stream.mode == MODE_STEP)
+    {
+      if(stream.step_idx < stream.step_total)
+      {
+        uint32_t dist = stream.step_total - 1U - stream.step_idx;
+        if(stream.step_idx < dist) dist = stream.step_idx;
+        if(dist < stream.step_ramp)
+        {
+          // Position in table in Q16, period falls with distance
+          uint32_t pos = dist * stream.step_scale;
+          uint32_t k = pos >> 16U;
+          if(k >= STEP_LUT_LEN)
+          {
+            stream.arr = stream.step_lut[STEP_LUT_LEN];
+          }
+          else
+          {
+            int32_t diff = (int32_t)(stream.step_lut[k + 1U] - stream.step_lut[k]);
+            stream.arr = stream.step_lut[k] + (int32_t)(((int64_t)diff * (pos & 0xFFFFU)) >> 16U);
+          }
+          stream.ccr = FracToCcr(stream.arr, stream.duty_frac);
+        }
+        else
+        {
+          stream.arr = stream.step_arr;
+          stream.ccr = stream.step_ccr;
+        }
+      }
+      else
+      {
+        stream.arr = stream.step_idle;
+        stream.ccr = 0U;
+      }
+      stream.step_idx++;
+    }
+    ptr[0U] = stream.arr;
+    ptr[stream.ccr_idx] = stream.ccr;
+    // Burst: pulses only in first periods of burst period, output is low in
+    // the rest of periods
+    if(stream.mode == MODE_BURST)
+    {
+      if(stream.burst_pos >= stream.burst_cycles) ptr[stream.ccr_idx] = 0U;
+      stream.burst_pos++;
+      if(stream.burst_pos >= stream.burst_periods) stream.burst_pos = 0U;
+    }
+    ptr += stream.burst_len;
+    // Spread: period of the next entry, compare value keeps duty. Compare is
+    // one 32x32 multiply by duty fraction, refill time is in fill_cycles.
+    if(stream.mode == MODE_SPREAD)
+    {
+      uint32_t offset;
+      if(stream.spread_shape == SPREAD_TRIANGLE)
+      {
+        // 0 -> 2^31 -> 0 over one phase accumulator period
+        stream.spread_phase += stream.spread_inc;
+        uint32_t tri = (stream.spread_phase & 0x80000000U) ? ~stream.spread_phase : stream.spread_phase;
+        offset = ((uint64_t)tri * (stream.spread_dev * 2U)) >> 31U;
+      }
+      else
+      {
+        stream.rng = Xorshift32(stream.rng);
+        offset = ((uint64_t)stream.rng * (stream.spread_dev * 2U + 1U)) >> 32U;
+      }
+      stream.arr = stream.spread_arr - stream.spread_dev + offset;
+      stream.ccr = FracToCcr(stream.arr, stream.duty_frac);
+    }
+    // Sweep stepped by time, so long period can contain few steps
+    if(stream.mode == MODE_SWEEP)
+    {
+      stream.elapsed += stream.arr + 1U;
+      if(stream.elapsed >= stream.step_cnt)
+      {
+        float freq = 0.0F;
+        while(stream.elapsed >= stream.step_cnt)
+        {
+          stream.elapsed -= stream.step_cnt;
+          freq = ch_dsc[ch].sweep.Step();
+        }
+        SetPwmStreamFrequency(stream, freq);
+      }
+    }
+  }
+  // Stepper: whole buffer is idle after move, circular DMA repeats it
+  // without refill
+  if((stream.mode == MODE_STEP) && stream.active && (stream.step_idx >= stream.step_total + stream.len))
+  {
+    __HAL_DMA_DISABLE_IT(stream.htim->hdma[TIM_DMA_ID_UPDATE], DMA_IT_HT | DMA_IT_TC);
+  }
+
+  stream.fill_cycles = DWT->CYCCNT - start_cycles;
+}
+
+// *****************************************************************************
+// ***   FillPrbsBlock   *******************************************************
+// *****************************************************************************
+void Application::FillPrbsBlock(uint8_t ch, uint32_t start, uint32_t cnt)
+{
+  PwmStreamType& stream = pwm_stream[CHANNEL_HW[ch].slot];
+  uint32_t* ptr = &stream.buf[start];
+  // Local copies allows compiler keep everything in registers
+  uint32_t lfsr = stream.lfsr;
+  uint32_t order = stream.lfsr_order;
+  uint32_t tap = stream.lfsr_tap;
+  uint32_t mask = (1U << order) - 1U;
+  uint32_t high = stream.ccr;
+  uint32_t err_left = stream.err_left;
+
+  for(uint32_t i = 0U; i < cnt; i++)
+  {
+    // Fibonacci LFSR, feedback bit is output bit
+    uint32_t bit = ((lfsr >> (order - 1U)) ^ (lfsr >> (tap - 1U))) & 1U;
+    lfsr = ((lfsr << 1U) | bit) & mask;
+    // Error injection inverts one bit every err_period bits
+    if(err_left != 0U)
+    {
+      err_left--;
+      if(err_left == 0U)
+      {
+        bit ^= 1U;
+        err_left = stream.err_period;
+      }
+    }
+    ptr[i] = high & (0U - bit);
+  }
+
+  stream.lfsr = lfsr;
+  stream.err_left = err_left;
+}
+
+// *****************************************************************************
+// ***   SetPwmStreamFrequency   ***********************************************
+// *****************************************************************************
+void Application::SetPwmStreamFrequency(PwmStreamType& stream, float freq)
+{
+  if(freq < MIN_FREQ) freq = MIN_FREQ;
+  if(freq > MAX_PWM_STREAM_FREQ) freq = MAX_PWM_STREAM_FREQ;
+  stream.arr = (uint32_t)(stream.clk / freq) - 1U;
+  stream.ccr = DutyToCcr(stream.arr, stream.duty);
+}
+
+// *****************************************************************************
+// ***   ArmTrigger   ************************************************************
+// *****************************************************************************
+void Application::ArmTrigger(uint8_t ch, TIM_HandleTypeDef& htim, uint32_t channel, TrigType trig)
+{
+  TriggerType& trg = trigger[ch];
+
+  trg.htim = &htim;
+  trg.channel = channel;
+  if(IsAnalogChannel(ch))
+  {
+    trg.hdma = CHANNEL_HW[ch].hdma;
+    trg.cnt = dac_data_cnt[CHANNEL_HW[ch].slot];
+  }
+  // Stopped output of previous trigger restored by setup, so action can be
+  // enabled for interrupt
+  trg.action = trig;
+}
+
+// *****************************************************************************
+// ***   LoadPwm   *************************************************************
+// *****************************************************************************
+void Application::LoadPwm(TIM_HandleTypeDef& htim, uint32_t channel, uint32_t arr, uint32_t ccr)
+{
+  TIM_TypeDef* tim = htim.Instance;
+
+  if(IsPwmFreeRunning(tim, channel))
+  {
+    // Preload registers take effect on update event. Update event is
+    // disabled while both are written, so no period gets new ARR with old
+    // CCR. Counter still wraps at old ARR meanwhile.
+    tim->CR1 |= TIM_CR1_UDIS;
+    tim->ARR = arr;
+    __HAL_TIM_SET_COMPARE(&htim, channel, ccr);
+    tim->CR1 &= ~TIM_CR1_UDIS;
+  }
+  else
+  {
+    // Counter is stopped or runs in other mode: finish last pulse and start
+    // free running PWM from zero
+    StopPwmAtUpdate(htim, channel);
+    tim->CR1 &= ~TIM_CR1_OPM;
+    SetOcMode(tim, channel, TIM_OCMODE_PWM1);
+    tim->ARR = arr;
+    __HAL_TIM_SET_COMPARE(&htim, channel, ccr);
+    // Counter is stopped, so update event doesn't cut anything
+    tim->EGR = TIM_EGR_UG;
+    StartPwmOutput(htim, channel);
+    tim->CR1 |= TIM_CR1_CEN;
+  }
+}
+
+// *****************************************************************************
+// ***   StopPwmAtUpdate   *****************************************************
+// *****************************************************************************
+void Application::StopPwmAtUpdate(TIM_HandleTypeDef& htim, uint32_t channel)
+{
+  TIM_TypeDef* tim = htim.Instance;
+
+  // Trigger shouldn't restart counter
+  tim->SMCR &= ~TIM_SMCR_SMS;
+  // Preload is used from now on
+  tim->CR1 |= TIM_CR1_ARPE;
+  __HAL_TIM_ENABLE_OCxPRELOAD(&htim, channel);
+  if(tim->CR1 & TIM_CR1_CEN)
+  {
+    // Output stays inactive after update event: compare value is zero for
+    // PWM mode 1 or above counter range for PWM mode 2
+    bool pwm2 = ((GetOcMode(tim, channel) & TIM_CCMR1_OC1M) == TIM_OCMODE_PWM2);
+    __HAL_TIM_SET_COMPARE(&htim, channel, pwm2 ? UINT32_MAX : 0U);
+    // Counter stops by itself at the end of current period, so wait is never
+    // longer than one period
+    tim->CR1 |= TIM_CR1_OPM;
+    while(tim->CR1 & TIM_CR1_CEN);
+  }
+}
+
+// *****************************************************************************
+// ***   StartPwmOutput   ******************************************************
+// *****************************************************************************
+void Application::StartPwmOutput(TIM_HandleTypeDef& htim, uint32_t channel)
+{
+  // Channel is started only once, HAL returns error for busy channel anyway
+  if((htim.Instance->CCER & (TIM_CCER_CC1E << channel)) == 0U)
+  {
+    (void) HAL_TIM_PWM_Start(&htim, channel);
+  }
+}
+
+// *****************************************************************************
+// ***   IsPwmFreeRunning   ****************************************************
+// *****************************************************************************
+bool Application::IsPwmFreeRunning(TIM_TypeDef* tim, uint32_t channel)
+{
+  // Counter enabled with auto-reload preload, not one pulse and not slave
+  bool counter = ((tim->CR1 & (TIM_CR1_CEN | TIM_CR1_OPM | TIM_CR1_ARPE)) == (TIM_CR1_CEN | TIM_CR1_ARPE)) &&
+                 ((tim->SMCR & TIM_SMCR_SMS) == 0U);
+  // Channel in PWM mode 1 with compare preload and enabled output
+  bool output = (GetOcMode(tim, channel) == (TIM_OCMODE_PWM1 | TIM_CCMR1_OC1PE)) &&
+                ((tim->CCER & (TIM_CCER_CC1E << channel)) != 0U);
+  return counter && output;
+}
+
+// *****************************************************************************
+// ***   GetOcMode   *************************************************************
+// *****************************************************************************
+uint32_t Application::GetOcMode(TIM_TypeDef* tim, uint32_t channel)
+{
+  uint32_t result = 0U;
+
+  // Result is for channel 1 bits position
+  switch(channel)
+  {
+    case TIM_CHANNEL_1:
+      result = tim->CCMR1 & (TIM_CCMR1_OC1M | TIM_CCMR1_OC1PE);
+      break;
+    case TIM_CHANNEL_2:
+      result = (tim->CCMR1 & (TIM_CCMR1_OC2M | TIM_CCMR1_OC2PE)) >> 8U;
+      break;
+    case TIM_CHANNEL_3:
+      result = tim->CCMR2 & (TIM_CCMR2_OC3M | TIM_CCMR2_OC3PE);
+      break;
+    case TIM_CHANNEL_4:
+      result = (tim->CCMR2 & (TIM_CCMR2_OC4M | TIM_CCMR2_OC4PE)) >> 8U;
+      break;
+    default:
+      break;
   }
 
   return result;
 }
 
+// *****************************************************************************
+// ***   SetOcMode   *************************************************************
+// *****************************************************************************
+void Application::SetOcMode(TIM_TypeDef* tim, uint32_t channel, uint32_t oc_mode)
+{
+  // TIM_OCMODE_x values are for channel 1 bits position
+  switch(channel)
+  {
+    case TIM_CHANNEL_1:
+      MODIFY_REG(tim->CCMR1, TIM_CCMR1_OC1M, oc_mode);
+      break;
+    case TIM_CHANNEL_2:
+      MODIFY_REG(tim->CCMR1, TIM_CCMR1_OC2M, oc_mode << 8U);
+      break;
+    case TIM_CHANNEL_3:
+      MODIFY_REG(tim->CCMR2, TIM_CCMR2_OC3M, oc_mode);
+      break;
+    case TIM_CHANNEL_4:
+      MODIFY_REG(tim->CCMR2, TIM_CCMR2_OC4M, oc_mode << 8U);
+      break;
+    default:
+      break;
+  }
+}
+
+// *****************************************************************************
+// ***   DeadTimeToDtg   *******************************************************
+// *****************************************************************************
+uint32_t Application::DeadTimeToDtg(uint32_t clocks, uint32_t& dt)
+{
+  uint32_t dtg = 0U;
+
+  // DTG[7:5] selects step and offset, DTG[4:0] or DTG[6:0] is multiplier:
+  // 0xx: DTG x 1, 10x: (64 + DTG[5:0]) x 2, 110: (32 + DTG[4:0]) x 8,
+  // 111: (32 + DTG[4:0]) x 16
+  if(clocks < 128U)
+  {
+    dtg = clocks;
+    dt = clocks;
+  }
+  else if(clocks < 256U)
+  {
+    dtg = 0x80U | (clocks / 2U - 64U);
+    dt = (clocks / 2U) * 2U;
+  }
+  else if(clocks < 512U)
+  {
+    dtg = 0xC0U | (clocks / 8U - 32U);
+    dt = (clocks / 8U) * 8U;
+  }
+  else if(clocks < 1024U)
+  {
+    dtg = 0xE0U | (clocks / 16U - 32U);
+    dt = (clocks / 16U) * 16U;
+  }
+  else
+  {
+    dtg = 0xFFU;
+    dt = 1008U;
+  }
+
+  return dtg;
+}
+
+// *****************************************************************************
+// ***   TriggerCallback   *******************************************************
+// *****************************************************************************
+void Application::TriggerCallback()
+{
+  // Edge timestamp captured by TIM3
+  uint16_t edge = htim3.Instance->CCR1;
+  bool sw_action = false;
+
+  for(uint32_t i = 0U; i < CHANNEL_CNT; i++)
+  {
+    TriggerType& trg = trigger[i];
+    TIM_TypeDef* tim = (trg.htim != nullptr) ? trg.htim->Instance : nullptr;
+
+    switch(trg.action)
+    {
+      case TRIG_START:
+      case TRIG_STEP:
+        if(IsAnalogChannel(i))
+        {
+          // Stop sampling timer, so first sample has the same delay from
+          // trigger regardless of timer phase
+          tim->CR1 &= ~TIM_CR1_CEN;
+          if(trg.action == TRIG_STEP)
+          {
+            // Restart DMA from the first sample of period
+            __HAL_DMA_DISABLE(trg.hdma);
+            while(trg.hdma->Instance->CR & DMA_SxCR_EN);
+            __HAL_DMA_CLEAR_FLAG(trg.hdma, __HAL_DMA_GET_TC_FLAG_INDEX(trg.hdma) | __HAL_DMA_GET_HT_FLAG_INDEX(trg.hdma) |
+                                           __HAL_DMA_GET_TE_FLAG_INDEX(trg.hdma) | __HAL_DMA_GET_DME_FLAG_INDEX(trg.hdma) |
+                                           __HAL_DMA_GET_FE_FLAG_INDEX(trg.hdma));
+            trg.hdma->Instance->NDTR = trg.cnt;
+            __HAL_DMA_ENABLE(trg.hdma);
+            // DAC stops DMA requests after underrun at the end of previous
+            // period, clear flag and enable requests again. Bits of DAC
+            // channel 2 are shifted by channel value as in HAL.
+            hdac.Instance->SR = DAC_SR_DMAUDR1 << trg.channel;
+            hdac.Instance->CR |= DAC_CR_DMAEN1 << trg.channel;
+          }
+          // Start sampling timer
+          tim->CNT = 0U;
+          tim->CR1 |= TIM_CR1_CEN;
+          // Start trigger fires once: next edges shouldn't restart waveform
+          // from its beginning. Counter of PWM timer in trigger mode ignores
+          // edges while it runs, so only DAC needs it.
+          if(trg.action == TRIG_START) trg.action = TRIG_OFF;
+          sw_action = true;
+        }
+        else
+        {
+          // Counter started in hardware, time from edge minus counter value is
+          // start latency. Valid only if counter hasn't wrapped yet.
+          uint16_t now = htim3.Instance->CNT;
+          uint32_t cnt = tim->CNT;
+          uint16_t elapsed = now - edge;
+          if((tim->CR1 & TIM_CR1_CEN) && ((tim->SR & TIM_SR_UIF) == 0U) && (cnt <= elapsed))
+          {
+            uint32_t lat = elapsed - cnt;
+            if(lat < trig_hw_min) trig_hw_min = lat;
+            if(lat > trig_hw_max) trig_hw_max = lat;
+          }
+        }
+        break;
+
+      case TRIG_STOP:
+        tim->CR1 &= ~TIM_CR1_CEN;
+        // DAC keeps the last sample, PWM output forced to low
+        if(!IsAnalogChannel(i)) SetOcMode(tim, trg.channel, TIM_OCMODE_FORCED_INACTIVE);
+        sw_action = true;
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  // Latency of software actions
+  if(sw_action)
+  {
+    uint16_t lat = htim3.Instance->CNT - edge;
+    if(lat < trig_sw_min) trig_sw_min = lat;
+    if(lat > trig_sw_max) trig_sw_max = lat;
+  }
+  trig_cnt++;
+}
+
+// *****************************************************************************
+// ***   DacDmaCallback   ******************************************************
+// *****************************************************************************
+void Application::DacDmaCallback(uint32_t dac_channel, uint32_t half)
+{
+  for(uint8_t ch = 0U; ch < CHANNEL_CNT; ch++)
+  {
+    const ChannelHwType& hw = CHANNEL_HW[ch];
+    // Refill half that just transferred
+    if(hw.analog && (hw.channel == dac_channel) && dds[hw.slot].active)
+    {
+      if(dds[hw.slot].waveform == WAVEFORM_NOISE) FillNoiseBlock(ch, dds[hw.slot].buf + half * DAC_STREAM_BLOCK);
+      else                                        FillDacBlock(ch, dds[hw.slot].buf + half * DAC_STREAM_BLOCK);
+      break;
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   PwmDmaCallback   ******************************************************
+// *****************************************************************************
+void Application::PwmDmaCallback(TIM_HandleTypeDef* htim, uint32_t half)
+{
+  for(uint8_t ch = 0U; ch < CHANNEL_CNT; ch++)
+  {
+    const ChannelHwType& hw = CHANNEL_HW[ch];
+    // Refill half that just transferred
+    if(!hw.analog && (pwm_stream[hw.slot].htim == htim) && pwm_stream[hw.slot].active)
+    {
+      uint32_t cnt = pwm_stream[hw.slot].len / 2U;
+      if(pwm_stream[hw.slot].mode == MODE_PRBS) FillPrbsBlock(ch, half * cnt, cnt);
+      else                                      FillPwmBlock(ch, half * cnt, cnt);
+      break;
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   HAL DMA callbacks   ***************************************************
+// *****************************************************************************
+extern "C" void HAL_DAC_ConvHalfCpltCallbackCh1(DAC_HandleTypeDef* hdac)
+{
+  Application::GetInstance().DacDmaCallback(DAC_CHANNEL_1, 0U);
+}
+
+extern "C" void HAL_DAC_ConvCpltCallbackCh1(DAC_HandleTypeDef* hdac)
+{
+  Application::GetInstance().DacDmaCallback(DAC_CHANNEL_1, 1U);
+}
+
+extern "C" void HAL_DACEx_ConvHalfCpltCallbackCh2(DAC_HandleTypeDef* hdac)
+{
+  Application::GetInstance().DacDmaCallback(DAC_CHANNEL_2, 0U);
+}
+
+extern "C" void HAL_DACEx_ConvCpltCallbackCh2(DAC_HandleTypeDef* hdac)
+{
+  Application::GetInstance().DacDmaCallback(DAC_CHANNEL_2, 1U);
+}
+
+extern "C" void HAL_TIM_PeriodElapsedHalfCpltCallback(TIM_HandleTypeDef* htim)
+{
+  Application::GetInstance().PwmDmaCallback(htim, 0U);
+}
+
+extern "C" void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef* htim)
+{
+  Application::GetInstance().PwmDmaCallback(htim, 1U);
+}
+
+// *****************************************************************************
+// ***   HAL trigger input capture callback   **********************************
+// *****************************************************************************
+extern "C" void HAL_TIM_IC_CaptureCallback(TIM_HandleTypeDef* htim)
+{
+  if(htim == &htim3)
+  {
+    Application::GetInstance().TriggerCallback();
+  }
+}
@@ -28,6 +28,14 @@
 #include "SoundDrv.h"
 #include "UiEngine.h"
 
+#include "NumFormatter.h"
+#include "WavePreview.h"
+#include "RleImage.h"
+#include "EncoderAccel.h"
+#include "Keypad.h"
+#include "Sweep.h"
+#include "PatternGen.h"
+
 #include "IIic.h"
 
 // *****************************************************************************
@@ -55,6 +63,24 @@ class Application : public AppTask
     // *************************************************************************
     virtual Result Loop();
 
+    // *************************************************************************
+    // ***   DacDmaCallback   **************************************************
+    // *************************************************************************
+    // Called from DAC DMA interrupt when half of buffer is transferred
+    void DacDmaCallback(uint32_t dac_channel, uint32_t half);
+
+    // *************************************************************************
+    // ***   PwmDmaCallback   **************************************************
+    // *************************************************************************
+    // Called from timer update DMA interrupt when half of buffer is transferred
+    void PwmDmaCallback(TIM_HandleTypeDef* htim, uint32_t half);
+
+    // *************************************************************************
+    // ***   TriggerCallback   *************************************************
+    // *************************************************************************
+    // Called from trigger input capture interrupt
+    void TriggerCallback();
+
   private:
 
     // *************************************************************************
@@ -78,9 +104,125 @@ class Application : public AppTask
       WAVEFORM_TRIANGLE,
       WAVEFORM_SAWTOOTH,
       WAVEFORM_SQUARE,
+      WAVEFORM_NOISE,
       WAVEFORM_CNT
     } WaveformType;
 
+    // *************************************************************************
+    // ***   Enum with all noise types   ***************************************
+    // *************************************************************************
+    typedef enum : uint8_t
+    {
+      NOISE_WHITE = 0U, // White, uniform distribution
+      NOISE_GAUSS,      // White, approximated gaussian distribution
+      NOISE_PINK,       // Pink, -3 dB/octave
+      NOISE_CNT
+    } NoiseType;
+
+    // *************************************************************************
+    // ***   Enum with all generator modes   ***********************************
+    // *************************************************************************
+    typedef enum : uint8_t
+    {
+      MODE_CONTINUOUS = 0U,
+      MODE_SWEEP,
+      MODE_AM,
+      MODE_FM,
+      MODE_PM,
+      MODE_BURST,
+      MODE_PRBS,
+      MODE_DITHER,
+      MODE_HOP,
+      MODE_SPREAD,
+      MODE_COMPL,
+      MODE_PHASE,
+      MODE_STEP,
+      MODE_CNT
+    } ModeType;
+
+    // *************************************************************************
+    // ***   Enum with all PRBS patterns   *************************************
+    // *************************************************************************
+    typedef enum : uint8_t
+    {
+      PRBS_7 = 0U,
+      PRBS_9,
+      PRBS_15,
+      PRBS_23,
+      PRBS_31,
+      PRBS_CNT
+    } PrbsType;
+
+    // *************************************************************************
+    // ***   Enum with spread spectrum period patterns   ***********************
+    // *************************************************************************
+    typedef enum : uint8_t
+    {
+      SPREAD_TRIANGLE = 0U, // Period swept up and down at modulation rate
+      SPREAD_RANDOM,        // Uniformly distributed random period
+      SPREAD_CNT
+    } SpreadType;
+
+    // *************************************************************************
+    // ***   Enum with stepper velocity profiles   *****************************
+    // *************************************************************************
+    typedef enum : uint8_t
+    {
+      STEP_TRAPEZOID = 0U, // Constant acceleration
+      STEP_SCURVE,         // Acceleration rises and falls as half of sine
+      STEP_PROFILE_CNT
+    } StepProfileType;
+
+    // *************************************************************************
+    // ***   Enum with trigger input actions   *********************************
+    // *************************************************************************
+    typedef enum : uint8_t
+    {
+      TRIG_OFF = 0U, // Free running output
+      TRIG_START,    // Output waits for the first trigger
+      TRIG_STOP,     // Output stops on trigger
+      TRIG_STEP,     // Every trigger produces one period
+      TRIG_CNT
+    } TrigType;
+
+    // *************************************************************************
+    // ***   Enum with duty encoder resolutions for digital channels   *********
+    // *************************************************************************
+    typedef enum : uint8_t
+    {
+      DUTY_RES_COARSE = 0U, // 1%
+      DUTY_RES_FINE,        // 0.01%
+      DUTY_RES_TICK,        // One timer count
+      DUTY_RES_CNT
+    } DutyResType;
+
+    // *************************************************************************
+    // ***   Flags for the channel UI elements that have to be redrawn   *******
+    // *************************************************************************
+    typedef enum : uint8_t
+    {
+      DIRTY_NONE  = 0x00U,
+      DIRTY_IMG   = 0x01U,
+      DIRTY_FREQ  = 0x02U,
+      DIRTY_DUTY  = 0x04U,
+      DIRTY_COLOR = 0x08U,
+      DIRTY_MODE  = 0x10U,
+      DIRTY_ALL   = 0x1FU
+    } DirtyType;
+
+    // *************************************************************************
+    // ***   Structure for one frequency hop   *********************************
+    // *************************************************************************
+    struct HopType
+    {
+      int32_t frequency;
+      // Duty as fraction of DUTY_FULL
+      int32_t duty;
+    };
+
+    // Maximum hops in list
+    static const uint32_t MAX_HOPS = 16U;
+
     // *************************************************************************
     // ***   Structure for describes all visual elements for the channel   *****
     // *************************************************************************
@@ -88,15 +230,116 @@ class Application : public AppTask
     {
       // UI data
       UiButton box;
-      Image img;
+      UiButton edit_btn;
+      RleImage img;
+      WavePreview preview;
       String freq_str;
       String duty_str;
+      String mode_str;
+      String param_str;
+      String trig_str;
+      String edge_str;
+      String res_str;
       char freq_str_data[64] = {0};
       char duty_str_data[64] = {0};
+      char mode_str_data[32] = {0};
+      char param_str_data[32] = {0};
+      char trig_str_data[8] = {0};
+      char edge_str_data[16] = {0};
+      char res_str_data[16] = {0};
+      // UI elements that have to be redrawn
+      uint8_t dirty = DIRTY_ALL;
       // Generator data
       int32_t frequency;
-      int8_t duty;
+      // Duty or amplitude as fraction of DUTY_FULL
+      int32_t duty;
+      DutyResType duty_res = DUTY_RES_COARSE;
       WaveformType waveform;
+      NoiseType noise = NOISE_WHITE;
+      ModeType mode = MODE_CONTINUOUS;
+      // Sweep data, frequency is start frequency of sweep
+      int32_t sweep_stop = 10000;
+      uint32_t sweep_time_ms = 1000U;
+      Sweep::LawType sweep_law = Sweep::LAW_LOG;
+      Sweep::DirType sweep_dir = Sweep::DIR_UP;
+      // Modulation data: LFO shape, rate in Hz and depth in percents
+      WaveformType mod_shape = WAVEFORM_SINE;
+      int32_t mod_rate = 10;
+      uint8_t mod_depth = 50U;
+      // Burst data: cycles in burst and burst repeat period
+      uint32_t burst_cycles = 10U;
+      uint32_t burst_period_ms = 100U;
+      // PRBS data: pattern and bits between injected errors, zero - no errors
+      PrbsType prbs = PRBS_15;
+      uint32_t prbs_err_period = 0U;
+      // Spread spectrum data: pattern and spread in percents, triangle rate is
+      // modulation rate
+      SpreadType spread_shape = SPREAD_TRIANGLE;
+      uint8_t spread = 5U;
+      // Complementary output data: dead-time and re-arm request counter,
+      // changed to restore output after break
+      uint32_t dead_time_ns = 100U;
+      uint32_t compl_arm = 0U;
+      // Interleaved bank data: count of phases and spacing between them in
+      // millidegrees, zero - evenly spaced
+      uint8_t phase_cnt = 2U;
+      uint32_t phase_spacing = 0U;
+      // Stepper data: steps in move, velocity profile, ramp time from start
+      // rate to frequency, start rate, direction and run request counter
+      // changed to repeat move
+      uint32_t step_cnt = 1000U;
+      StepProfileType step_profile = STEP_TRAPEZOID;
+      uint32_t step_ramp_ms = 500U;
+      int32_t step_start = 1000;
+      bool step_dir = false;
+      uint32_t step_run = 0U;
+      // Hop data: list, PWM periods per hop and list version changed on every
+      // edit. Empty list is FSK between frequency and sweep stop frequency.
+      HopType hops[MAX_HOPS];
+      uint32_t hop_cnt = 0U;
+      uint32_t hop_dwell = 100U;
+      uint32_t hop_ver = 0U;
+      // Trigger input action, used in continuous mode
+      TrigType trig = TRIG_OFF;
+      // Generator data applied to the hardware
+      int32_t applied_frequency = 0;
+      int32_t applied_duty = 0;
+      WaveformType applied_waveform = WAVEFORM_CNT;
+      NoiseType applied_noise = NOISE_CNT;
+      ModeType applied_mode = MODE_CNT;
+      int32_t applied_sweep_stop = 0;
+      uint32_t applied_sweep_time_ms = 0U;
+      Sweep::LawType applied_sweep_law = Sweep::LAW_CNT;
+      Sweep::DirType applied_sweep_dir = Sweep::DIR_CNT;
+      WaveformType applied_mod_shape = WAVEFORM_CNT;
+      int32_t applied_mod_rate = 0;
+      uint8_t applied_mod_depth = 0U;
+      uint32_t applied_burst_cycles = 0U;
+      uint32_t applied_burst_period_ms = 0U;
+      PrbsType applied_prbs = PRBS_CNT;
+      uint32_t applied_prbs_err_period = 0U;
+      uint32_t applied_hop_dwell = 0U;
+      SpreadType applied_spread_shape = SPREAD_CNT;
+      uint8_t applied_spread = 0U;
+      uint32_t applied_dead_time_ns = 0U;
+      uint32_t applied_compl_arm = 0U;
+      uint8_t applied_phase_cnt = 0U;
+      uint32_t applied_phase_spacing = 0U;
+      uint32_t applied_step_cnt = 0U;
+      StepProfileType applied_step_profile = STEP_PROFILE_CNT;
+      uint32_t applied_step_ramp_ms = 0U;
+      int32_t applied_step_start = 0;
+      bool applied_step_dir = false;
+      uint32_t applied_step_run = 0U;
+      uint32_t applied_hop_ver = 0U;
+      TrigType applied_trig = TRIG_CNT;
+      // Sweep engine, stepped from DMA interrupt
+      Sweep sweep;
+      // Flag, time and parameters signature of request to apply generator
+      // data to the hardware
+      bool apply_pending = false;
+      uint32_t apply_request_ms = 0U;
+      uint32_t apply_sig = 0U;
     };
     // Visual channel descriptions
     ChannelDescriptionType ch_dsc[CHANNEL_CNT];
@@ -105,6 +348,159 @@ class Application : public AppTask
     static constexpr double PI = 3.1415926535897932384626433832795F;
 
     static const uint32_t DAC_MAX_VAL = 0x00000FFFU;
+    // DAC reference voltage in mV
+    static const uint32_t DAC_VREF_MV = 3300U;
+
+    // Duty and amplitude are fixed-point fraction in parts per billion. It is
+    // finer than one count of 32-bit timer at the lowest frequency.
+    static const int32_t DUTY_FULL = 1000000000;
+    // Duty steps: 1% and 0.01%
+    static const int32_t DUTY_STEP_COARSE = DUTY_FULL / 100;
+    static const int32_t DUTY_STEP_FINE = DUTY_FULL / 10000;
+
+    // Frequency limits
+    static const int32_t MIN_FREQ = 100;
+    static const int32_t MAX_ANALOG_FREQ = 200000;
+    static const int32_t MAX_DIGITAL_FREQ = 10000000;
+    // PWM-DAC: sample is at least PWM_DAC_MIN_CNT timer counts(8 bit) and
+    // period is at least 32 samples
+    static const uint32_t PWM_DAC_MIN_CNT = 256U;
+    static const int32_t MAX_PWM_DAC_FREQ = 10000;
+
+    // Sweep time limits
+    static const uint32_t MIN_SWEEP_TIME_MS = 10U;
+    static const uint32_t MAX_SWEEP_TIME_MS = 100000U;
+
+    // Modulation rate limits
+    static const int32_t MIN_MOD_RATE = 1;
+    static const int32_t MAX_MOD_RATE = 10000;
+
+    // Burst limits
+    static const uint32_t MAX_BURST_CYCLES = 1000000U;
+    static const uint32_t MIN_BURST_PERIOD_MS = 1U;
+    static const uint32_t MAX_BURST_PERIOD_MS = 100000U;
+
+    // Maximum time to postpone hardware update while user still rotates encoder
+    static const uint32_t APPLY_MAX_DELAY_MS = 300U;
+    // FNV-1a offset basis for signature of apply request parameters
+    static const uint32_t APPLY_SIG_SEED = 2166136261U;
+
+    // Count of analog channels, they are first in the channel list
+    static const uint32_t ANALOG_CHANNEL_CNT = 2U;
+
+    // *************************************************************************
+    // ***   Structure for channel hardware   **********************************
+    // *************************************************************************
+    struct ChannelHwType
+    {
+      // DAC or PWM output
+      bool analog;
+      // Analog channel: DAC channel and its sample timer. Digital channel:
+      // PWM timer and its channel.
+      TIM_HandleTypeDef* htim;
+      uint32_t channel;
+      // Index of channel state in dds or pwm_stream and DAC data arrays
+      uint8_t slot;
+      // DMA of DAC channel, PWM stream uses DMA of its timer
+      DMA_HandleTypeDef* hdma;
+      // Trigger input of PWM timer connected to TIM3 capture
+      uint32_t trig_itr;
+      // Direction output of stepper mode for digital channel
+      GPIO_TypeDef* dir_port;
+      uint16_t dir_pin;
+      // Output pin of digital channel and its alternate function for PWM
+      // timer
+      GPIO_TypeDef* out_port;
+      uint16_t out_pin;
+      uint8_t out_af;
+      // APB2 timer on the same pin for high resolution PWM, its channel and
+      // alternate function
+      TIM_HandleTypeDef* hires_htim;
+      uint32_t hires_channel;
+      uint8_t hires_af;
+    };
+    // Hardware of each channel, channel setup has no per channel code
+    static const ChannelHwType CHANNEL_HW[CHANNEL_CNT];
+
+    // DAC sampling frequency in streaming modes. Estimated cost of buffer
+    // refill at 168 MHz(measured value shown in debug string):
+    //   Continuous and sweep - ~5 cycles per sample
+    //   AM - ~12, FM - ~9, PM - ~11 cycles per sample
+    //   Noise: white ~12, gaussian ~20, pink ~20 cycles per sample
+    // At 1 MS/s one channel in AM mode takes ~12 / 168 = 7% of CPU time, both
+    // channels ~14%. At 500 kS/s and 250 kS/s load is half and quarter of it.
+    // Noise bandwidth is FS / 2 = 500 kHz. Limit is DAC update rate(1 MS/s
+    // maximum), not the noise kernel.
+    static const uint32_t DAC_STREAM_FS = 1000000U;
+    // Samples in one half of DAC ping-pong buffer
+    static const uint32_t DAC_STREAM_BLOCK = 256U;
+    // Time of one DAC block, sweep is stepped once per block
+    static const uint32_t DAC_STREAM_BLOCK_US = (DAC_STREAM_BLOCK * 1000000U) / DAC_STREAM_FS;
+    // DDS look-up table size and phase accumulator shift to get table index
+    static const uint32_t DDS_LUT_SIZE = 1024U;
+    static const uint32_t DDS_LUT_SHIFT = 22U;
+    // Frequency to phase increment conversion coefficient: 2^32 / FS
+    static constexpr float DDS_PHASE_SCALE = 4294967296.0F / DAC_STREAM_FS;
+    // Modulation LFO look-up table size and phase accumulator shift
+    static const uint32_t LFO_LUT_SIZE = 256U;
+    static const uint32_t LFO_LUT_SHIFT = 24U;
+    // Middle of DAC range, center of generated waveforms
+    static const int32_t DAC_MID_VAL = DAC_MAX_VAL / 2U;
+    // Voss-McCartney pink noise rows: row N updated every 2^(N+1) samples
+    static const uint32_t PINK_ROWS = 16U;
+
+    // PWM periods in DMA ring buffer, refilled by halves
+    static const uint32_t PWM_STREAM_LEN = 128U;
+    // Maximum DMA burst length: ARR, RCR, CCR1, CCR2, CCR3, CCR4
+    static const uint32_t PWM_BURST_MAX_LEN = 6U;
+    // Sweep step time for PWM channels
+    static const uint32_t PWM_STREAM_STEP_US = 100U;
+    // Maximum frequency of streamed PWM limited by DMA and interrupt load
+    static const int32_t MAX_PWM_STREAM_FREQ = 1000000;
+    // Maximum PRBS bit rate: one DMA word per bit, DMA1 shared with DAC
+    // streams. Refill costs ~10 cycles per bit: ~30% of CPU at 5 Mbit/s for
+    // PRBS15 and longer. PRBS7 and PRBS9 without errors fit into buffer as
+    // whole periods and need no refill.
+    static const int32_t MAX_PRBS_RATE = 5000000;
+    // PWM periods in dither sequence, whole DMA buffer. Average duty resolution
+    // is 1 / (DITHER_LEN * (ARR + 1)): ~0.016% at 10 MHz. Sequence repeats
+    // without refill, so dithering works up to MAX_DIGITAL_FREQ with one DMA
+    // word per period and no interrupts.
+    static const uint32_t DITHER_LEN = PWM_STREAM_LEN * PWM_BURST_MAX_LEN;
+    // Spread spectrum limits in percents of period
+    static const int32_t MIN_SPREAD = 1;
+    static const int32_t MAX_SPREAD = 10;
+    // Maximum dead-time: DTG gives up to 1008 clocks of TIM1, 6 us at 168 MHz
+    static const uint32_t MAX_DEAD_TIME_NS = 6000U;
+    // Interleaved PWM bank: phase count limits, counters and maximum phase
+    // spacing in millidegrees. Bank is output of CH4, its master is TIM2 and
+    // CH3 timer is taken as slave.
+    static const uint8_t MIN_PHASES = 2U;
+    static const uint8_t MAX_PHASES = 6U;
+    static const uint32_t PHASE_TIMER_CNT = 3U;
+    static const uint32_t MAX_PHASE_SPACING = 359999U;
+    static const ChannelType PHASE_CHANNEL = CHANNEL_4;
+    static const ChannelType PHASE_SLAVE_CHANNEL = CHANNEL_3;
+    // Counts before turning point of bank counter needed to write compare
+    // preload with interrupts disabled, 16 counts is 32 CPU cycles
+    static const uint32_t PHASE_WRITE_MARGIN = 16U;
+    // Counts of low part of outgoing PWM left when channel pin is switched
+    // between timers: 48 counts is at least 48 CPU cycles
+    static const uint32_t PWM_SWITCH_MARGIN = 48U;
+    // Stepper: maximum steps in move, ramp velocity table size and maximum
+    // ramp time. Step rate is limited by MAX_PWM_STREAM_FREQ.
+    static const uint32_t MAX_STEPS = 1000000000U;
+    static const uint32_t STEP_LUT_LEN = 256U;
+    static const uint32_t MAX_STEP_RAMP_MS = 100000U;
+    // Maximum PWM periods per hop
+    static const uint32_t MAX_HOP_DWELL = 1000000U;
+    // Maximum bits between injected errors
+    static const uint32_t MAX_PRBS_ERR_PERIOD = 1000000000U;
+    // Maximum repeats of pattern in burst mode
+    static const uint32_t MAX_PATTERN_REPEAT = 1000000U;
+    // Pattern file on SD card, used if pattern isn't received over USB and in
+    // stream mode
+    static constexpr const char* PATTERN_FILE = "PATTERN.BIN";
 
     // Display driver instance
     DisplayDrv& display_drv = DisplayDrv::GetInstance();
@@ -112,23 +508,388 @@ class Application : public AppTask
     InputDrv& input_drv = InputDrv::GetInstance();
     // Sound driver instance
     SoundDrv& sound_drv = SoundDrv::GetInstance();
+    // Pattern generator instance
+    PatternGen& pattern = PatternGen::GetInstance();
 
-    // DAC arrays
-    uint16_t dac1_data[1024U] = {0};
-    uint16_t dac2_data[1024U] = {0};
+    // DAC arrays of analog channels
+    uint16_t dac_data[ANALOG_CHANNEL_CNT][1024U] = {{0}};
+    // Count of used samples in DAC arrays
+    uint32_t dac_data_cnt[ANALOG_CHANNEL_CNT] = {0};
+    // PWM-DAC waveform, converted to compare values in stream buffer
+    uint16_t pwm_dac_data[PWM_STREAM_LEN * PWM_BURST_MAX_LEN] = {0};
+
+    // *************************************************************************
+    // ***   Structure for DDS state of analog channel in streaming modes   ****
+    // *************************************************************************
+    struct DdsType
+    {
+      // One period of waveform
+      uint16_t lut[DDS_LUT_SIZE] = {0};
+      // Phase accumulator and increment per sample
+      uint32_t phase = 0U;
+      uint32_t phase_inc = 0U;
+      // One period of modulation LFO, Q15 signed values
+      int16_t lfo_lut[LFO_LUT_SIZE] = {0};
+      // LFO phase accumulator and increment per sample
+      uint32_t lfo_phase = 0U;
+      uint32_t lfo_inc = 0U;
+      // Modulation depth coefficient: Q15 gain for AM, phase increment
+      // deviation for FM, phase deviation for PM
+      int32_t mod_coef = 0;
+      // Burst: cycles in burst, samples in burst period, cycles left in
+      // current burst, samples since start of current burst and idle value
+      uint32_t burst_cycles = 0U;
+      uint32_t burst_samples = 0U;
+      uint32_t burst_left = 0U;
+      uint32_t burst_pos = 0U;
+      uint16_t idle_val = 0U;
+      // Noise: type, PRNG state, scale in Q16 and offset to get DAC value
+      WaveformType waveform = WAVEFORM_SINE;
+      NoiseType noise = NOISE_WHITE;
+      uint32_t rng = 0U;
+      uint32_t noise_scale = 0U;
+      uint32_t noise_offset = 0U;
+      // Pink noise rows, sum of rows and sample counter selecting row
+      uint8_t pink_rows[PINK_ROWS] = {0};
+      uint32_t pink_sum = 0U;
+      uint32_t pink_cnt = 0U;
+      // CPU cycles of the last buffer refill
+      uint32_t fill_cycles = 0U;
+      // DAC ping-pong buffer
+      uint16_t* buf = nullptr;
+      // Streaming mode
+      ModeType mode = MODE_CONTINUOUS;
+      // Buffer refilled from DMA interrupt
+      volatile bool active = false;
+    };
+    // DDS state for analog channels
+    DdsType dds[ANALOG_CHANNEL_CNT];
+
+    // *************************************************************************
+    // ***   Structure for PWM channel state in streaming modes   **************
+    // *************************************************************************
+    struct PwmStreamType
+    {
+      // DMA burst buffer, one burst per PWM period
+      uint32_t buf[PWM_STREAM_LEN * PWM_BURST_MAX_LEN] = {0};
+      // Timer and its clock
+      TIM_HandleTypeDef* htim = nullptr;
+      uint32_t clk = 0U;
+      // Entries in buffer, words in one entry and index of CCRx in it
+      uint32_t len = 0U;
+      uint32_t burst_len = 0U;
+      uint32_t ccr_idx = 0U;
+      // Current period and compare values, duty and duty as Q32 fraction of
+      // period for compare values computed per period
+      uint32_t arr = 0U;
+      uint32_t ccr = 0U;
+      int32_t duty = 0;
+      uint32_t duty_frac = 0U;
+      // Streaming mode
+      ModeType mode = MODE_CONTINUOUS;
+      // Timer counts since last sweep step and counts per sweep step
+      uint32_t elapsed = 0U;
+      uint32_t step_cnt = 0U;
+      // Burst: PWM periods with pulse, PWM periods in burst period and
+      // position in burst period
+      uint32_t burst_cycles = 0U;
+      uint32_t burst_periods = 0U;
+      uint32_t burst_pos = 0U;
+      // PRBS: LFSR state, order and feedback tap, bits between errors and
+      // bits left to next error
+      uint32_t lfsr = 0U;
+      uint32_t lfsr_order = 0U;
+      uint32_t lfsr_tap = 0U;
+      uint32_t err_period = 0U;
+      uint32_t err_left = 0U;
+      // Hop: precomputed period and compare values, count of hops, PWM
+      // periods per hop, current hop and periods left in it
+      uint32_t hop_arr[MAX_HOPS] = {0};
+      uint32_t hop_ccr[MAX_HOPS] = {0};
+      uint32_t hop_cnt = 0U;
+      uint32_t hop_dwell = 0U;
+      uint32_t hop_idx = 0U;
+      uint32_t hop_left = 0U;
+      // Spread: pattern, center period, maximum deviation of period in timer
+      // counts, triangle phase accumulator and increment per period, PRNG
+      // state
+      SpreadType spread_shape = SPREAD_TRIANGLE;
+      uint32_t spread_arr = 0U;
+      uint32_t spread_dev = 0U;
+      uint32_t spread_phase = 0U;
+      uint32_t spread_inc = 0U;
+      uint32_t rng = 0U;
+      // Stepper: step period in timer counts over ramp distance, table
+      // entries per step in Q16, steps in ramp, cruise period and compare
+      // values, idle period after move, steps in move and index of the next
+      // step
+      uint32_t step_lut[STEP_LUT_LEN + 1U] = {0};
+      uint32_t step_scale = 0U;
+      uint32_t step_ramp = 0U;
+      uint32_t step_arr = 0U;
+      uint32_t step_ccr = 0U;
+      uint32_t step_idle = 0U;
+      uint32_t step_total = 0U;
+      volatile uint32_t step_idx = 0U;
+      // CPU cycles of the last buffer refill
+      uint32_t fill_cycles = 0U;
+      // Buffer refilled from DMA interrupt
+      volatile bool active = false;
+    };
+    // Stream state for digital channels
+    PwmStreamType pwm_stream[CHANNEL_CNT - ANALOG_CHANNEL_CNT];
+
+    // *************************************************************************
+    // ***   Structure for channel hardware used by trigger interrupt   ********
+    // *************************************************************************
+    struct TriggerType
+    {
+      // Timer and its channel. For analog channels channel is DAC channel.
+      TIM_HandleTypeDef* htim = nullptr;
+      uint32_t channel = 0U;
+      // DAC DMA and count of samples in one period for step action
+      DMA_HandleTypeDef* hdma = nullptr;
+      uint32_t cnt = 0U;
+      // Action on trigger, TRIG_OFF while channel is reconfigured
+      volatile TrigType action = TRIG_OFF;
+    };
+    // Trigger state for all channels
+    TriggerType trigger[CHANNEL_CNT];
+    // Count of triggers, shown count and latency ranges in TIM3 counts:
+    // software is from edge to the end of interrupt actions, hardware is from
+    // edge to start of triggered PWM counter
+    volatile uint32_t trig_cnt = 0U;
+    uint32_t trig_cnt_shown = 0U;
+    volatile uint32_t trig_sw_min = UINT32_MAX;
+    volatile uint32_t trig_sw_max = 0U;
+    volatile uint32_t trig_hw_min = UINT32_MAX;
+    volatile uint32_t trig_hw_max = 0U;
+
+    // Channel that outputs complementary PWM on TIM1, CHANNEL_CNT if none,
+    // and shown break state
+    uint8_t compl_ch = CHANNEL_CNT;
+    bool compl_break_shown = false;
+
+    // Channel that outputs PWM on TIM9, CHANNEL_CNT if none. Both digital
+    // channels share TIM9 counter, so only one of them can use it.
+    uint8_t hires_ch = CHANNEL_CNT;
+
+    // *************************************************************************
+    // ***   Structure for counter of interleaved PWM bank   *******************
+    // *************************************************************************
+    // Counter runs in center-aligned mode: channel in PWM mode 1 outputs pulse
+    // centered at counter valley, partner channel in PWM mode 2 outputs pulse
+    // of the same width centered at peak, half period later. So each counter
+    // gives two phases 180 degrees apart.
+    struct PhaseTimerType
+    {
+      // Timer, channel and partner channel
+      TIM_HandleTypeDef* htim;
+      uint32_t channel;
+      uint32_t partner;
+      // Trigger input connected to master TIM2, timer is clocked from APB2
+      uint32_t ts;
+      bool apb2;
+      // Pin names of channel and partner
+      const char* pins[2U];
+    };
+    // Bank counters, the first one is master
+    const PhaseTimerType phase_timers[PHASE_TIMER_CNT] =
+    {
+      {&htim2, TIM_CHANNEL_3, TIM_CHANNEL_4, 0U,          false, {"A2", "B11"}},
+      {&htim5, TIM_CHANNEL_4, TIM_CHANNEL_1, TIM_TS_ITR0, false, {"A3", "A0"}},
+      {&htim1, TIM_CHANNEL_2, TIM_CHANNEL_3, TIM_TS_ITR1, true,  {"A9", "A10"}}
+    };
+
+    // *************************************************************************
+    // ***   Structure for interleaved PWM bank state   ************************
+    // *************************************************************************
+    struct PhaseBankType
+    {
+      // Counters used, valley angle of each counter in millidegrees, used
+      // outputs of each counter(bit 0 - channel, bit 1 - partner) and output
+      // of each phase: counter * 2 + 1 for partner
+      uint32_t counters = 0U;
+      uint32_t angle[PHASE_TIMER_CNT] = {0};
+      uint8_t used[PHASE_TIMER_CNT] = {0};
+      uint8_t out[MAX_PHASES] = {0};
+      // Counter start value and flag that channel and partner swap PWM modes
+      uint32_t start[PHASE_TIMER_CNT] = {0};
+      bool swap[PHASE_TIMER_CNT] = {false};
+      // Phase count and spacing, prescaler and half period in counts
+      uint8_t phase_cnt = 0U;
+      uint32_t spacing = 0U;
+      uint32_t psc = 0U;
+      uint32_t arr = 0U;
+      // Bank outputs PWM, slave channel is taken
+      bool active = false;
+    };
+    // Interleaved PWM bank state
+    PhaseBankType phase_bank;
+
+    // Pattern generator mode, burst repeats and requested word rate
+    PatternGen::ModeType pattern_mode = PatternGen::MODE_LOOP;
+    uint32_t pattern_repeat = 1U;
+    uint32_t pattern_rate = 0U;
+    uint32_t pattern_underruns_shown = 0U;
 
     // Current selected channel
     ChannelType channel = CHANNEL_1;
+    // Keypad for direct value entry
+    Keypad keypad;
+    // Frequency encoder acceleration
+    EncoderAccel freq_accel;
     // Encoder last buttons values
     bool enc_btn_val[InputDrv::EXT_MAX][InputDrv::ENC_BTN_MAX] = {0};
     // Need update display and generator params
     bool update = true;
+    // Count of generator updates replaced by newer one before it was applied
+    uint32_t dropped_updates = 0U;
+    // Count of pixels invalidated by the last UI update
+    uint32_t update_pixels = 0U;
+    // CPU cycles spent to format strings during the last UI update
+    uint32_t format_cycles = 0U;
+
+    // Debug string
+    String dbg_str;
+    char dbg_str_data[64] = {0};
+    // Trigger debug string
+    String trig_dbg_str;
+    char trig_dbg_str_data[64] = {0};
+    // Pattern generator debug string
+    String pat_dbg_str;
+    char pat_dbg_str_data[64] = {0};
 
     // *************************************************************************
     // ***   Callback   ********************************************************
     // *************************************************************************
     static Result Callback(Application* app, void* ptr);
 
+    // *************************************************************************
+    // ***   KeypadCallback   **************************************************
+    // *************************************************************************
+    static Result KeypadCallback(Application* app, Keypad* kp);
+
+    // *************************************************************************
+    // ***   SelectChannel   ***************************************************
+    // *************************************************************************
+    void SelectChannel(ChannelType ch);
+
+    // *************************************************************************
+    // ***   NextWaveform   ****************************************************
+    // *************************************************************************
+    void NextWaveform(ChannelType ch);
+
+    // *************************************************************************
+    // ***   NextMode   ********************************************************
+    // *************************************************************************
+    void NextMode(ChannelType ch);
+
+    // *************************************************************************
+    // ***   NextDutyRes   *****************************************************
+    // *************************************************************************
+    void NextDutyRes(ChannelType ch);
+
+    // *************************************************************************
+    // ***   UpdateUi   ********************************************************
+    // *************************************************************************
+    void UpdateUi();
+
+    // *************************************************************************
+    // ***   UpdateModeStrings   ***********************************************
+    // *************************************************************************
+    void UpdateModeStrings(uint8_t ch);
+
+    // *************************************************************************
+    // ***   SetFrequency   ****************************************************
+    // *************************************************************************
+    void SetFrequency(ChannelType ch, int64_t freq);
+
+    // *************************************************************************
+    // ***   SetDuty   *********************************************************
+    // *************************************************************************
+    void SetDuty(ChannelType ch, int64_t duty);
+
+    // *************************************************************************
+    // ***   SetSweepStop   ****************************************************
+    // *************************************************************************
+    void SetSweepStop(ChannelType ch, int64_t freq);
+
+    // *************************************************************************
+    // ***   SetSweepTime   ****************************************************
+    // *************************************************************************
+    void SetSweepTime(ChannelType ch, uint64_t time_ms);
+
+    // *************************************************************************
+    // ***   SetModRate   ******************************************************
+    // *************************************************************************
+    void SetModRate(ChannelType ch, int64_t rate);
+
+    // *************************************************************************
+    // ***   SetModDepth   *****************************************************
+    // *************************************************************************
+    void SetModDepth(ChannelType ch, int64_t depth);
+
+    // *************************************************************************
+    // ***   SetSpread   *******************************************************
+    // *************************************************************************
+    void SetSpread(ChannelType ch, int64_t spread);
+
+    // *************************************************************************
+    // ***   SetDeadTime   *****************************************************
+    // *************************************************************************
+    void SetDeadTime(ChannelType ch, uint64_t time_ns);
+
+    // *************************************************************************
+    // ***   SetPhaseSpacing   *************************************************
+    // *************************************************************************
+    void SetPhaseSpacing(ChannelType ch, uint64_t spacing);
+
+    // *************************************************************************
+    // ***   SetStepCount   ****************************************************
+    // *************************************************************************
+    void SetStepCount(ChannelType ch, uint64_t steps);
+
+    // *************************************************************************
+    // ***   SetStepRamp   *****************************************************
+    // *************************************************************************
+    void SetStepRamp(ChannelType ch, uint64_t time_ms);
+
+    // *************************************************************************
+    // ***   SetStepStart   ****************************************************
+    // *************************************************************************
+    void SetStepStart(ChannelType ch, int64_t rate);
+
+    // *************************************************************************
+    // ***   SetBurstCycles   **************************************************
+    // *************************************************************************
+    void SetBurstCycles(ChannelType ch, uint64_t cycles);
+
+    // *************************************************************************
+    // ***   SetBurstPeriod   **************************************************
+    // *************************************************************************
+    void SetBurstPeriod(ChannelType ch, uint64_t period_ms);
+
+    // *************************************************************************
+    // ***   SetPrbsErrPeriod   ************************************************
+    // *************************************************************************
+    void SetPrbsErrPeriod(ChannelType ch, uint64_t bits);
+
+    // *************************************************************************
+    // ***   SetHopDwell   *****************************************************
+    // *************************************************************************
+    void SetHopDwell(ChannelType ch, uint64_t periods);
+
+    // *************************************************************************
+    // ***   ProcessHopEntry   *************************************************
+    // *************************************************************************
+    void ProcessHopEntry(Keypad::UnitType unit, uint64_t value);
+
+    // *************************************************************************
+    // ***   ProcessPatternEntry   *********************************************
+    // *************************************************************************
+    void ProcessPatternEntry(Keypad::UnitType unit, uint64_t value);
+
     // *************************************************************************
     // ***   ProcessFrequencyChange   ******************************************
     // *************************************************************************
@@ -139,25 +900,426 @@ class Application : public AppTask
     // *************************************************************************
     bool ProcessDutyChange(int32_t steps);
 
+    // *************************************************************************
+    // ***   RequestApply   ****************************************************
+    // *************************************************************************
+    void RequestApply(uint8_t ch);
+
+    // *************************************************************************
+    // ***   ProcessApply   ****************************************************
+    // *************************************************************************
+    void ProcessApply(bool input_active);
+
+    // *************************************************************************
+    // ***   ApplyChannel   ****************************************************
+    // *************************************************************************
+    Result ApplyChannel(uint8_t ch);
+
+    // *************************************************************************
+    // ***   UpdatePreview   ***************************************************
+    // *************************************************************************
+    void UpdatePreview(uint8_t ch, const uint16_t* dac_data, uint32_t dac_data_cnt);
+
     // *************************************************************************
     // ***   GenerateWave   ****************************************************
     // *************************************************************************
-    Result GenerateWave(uint16_t* dac_data, uint32_t dac_data_cnt, uint8_t duty, WaveformType waveform);
+    Result GenerateWave(uint16_t* dac_data, uint32_t dac_data_cnt, int32_t duty, WaveformType waveform);
+
+    // *************************************************************************
+    // ***   GenerateLfo   *****************************************************
+    // *************************************************************************
+    void GenerateLfo(int16_t* lfo_data, uint32_t lfo_data_cnt, WaveformType waveform);
 
     // *************************************************************************
     // ***   Setup DAC   *******************************************************
     // *************************************************************************
-    Result SetupDac(DAC_HandleTypeDef& hdac, uint32_t channel, TIM_HandleTypeDef& htim, uint32_t freq, uint8_t duty, WaveformType waveform);
+    Result SetupDac(DAC_HandleTypeDef& hdac, uint32_t channel, TIM_HandleTypeDef& htim, uint8_t ch, uint32_t freq, int32_t duty, WaveformType waveform, TrigType trig);
 
     // *************************************************************************
     // ***   Setup PWM   *******************************************************
     // *************************************************************************
-    Result SetupPwm(TIM_HandleTypeDef& htim, uint32_t channel, uint32_t freq, uint8_t duty);
+    Result SetupPwm(TIM_HandleTypeDef& htim, uint32_t channel, uint8_t ch, uint32_t freq, int32_t duty, TrigType trig);
+
+    // *************************************************************************
+    // ***   Setup DAC Stream   ************************************************
+    // *************************************************************************
+    Result SetupDacStream(DAC_HandleTypeDef& hdac, uint32_t channel, TIM_HandleTypeDef& htim, uint8_t ch);
+
+    // *************************************************************************
+    // ***   Setup PWM Stream   ************************************************
+    // *************************************************************************
+    Result SetupPwmStream(TIM_HandleTypeDef& htim, uint32_t channel, uint8_t ch);
+
+    // *************************************************************************
+    // ***   Setup PRBS Stream   ***********************************************
+    // *************************************************************************
+    Result SetupPrbsStream(TIM_HandleTypeDef& htim, uint32_t channel, uint8_t ch);
+
+    // *************************************************************************
+    // ***   Setup Dither Stream   *********************************************
+    // *************************************************************************
+    Result SetupDitherStream(TIM_HandleTypeDef& htim, uint32_t channel, uint8_t ch);
+
+    // *************************************************************************
+    // ***   Setup Hop Stream   ************************************************
+    // *************************************************************************
+    Result SetupHopStream(TIM_HandleTypeDef& htim, uint32_t channel, uint8_t ch);
+
+    // *************************************************************************
+    // ***   Setup PWM DAC   ***************************************************
+    // *************************************************************************
+    Result SetupPwmDac(TIM_HandleTypeDef& htim, uint32_t channel, uint8_t ch);
+
+    // *************************************************************************
+    // ***   Setup Complementary PWM   *****************************************
+    // *************************************************************************
+    // Output of channel timer is stopped, TIM1 outputs PWM with dead-time
+    Result SetupCompl(TIM_HandleTypeDef& htim, uint32_t channel, uint8_t ch);
+
+    // *************************************************************************
+    // ***   Stop Complementary PWM   ******************************************
+    // *************************************************************************
+    void StopCompl();
+
+    // *************************************************************************
+    // ***   Setup High Resolution PWM   ***************************************
+    // *************************************************************************
+    // Channel pin is switched to APB2 timer after it outputs new PWM
+    Result SetupHiresPwm(uint8_t ch, uint32_t freq, int32_t duty);
+
+    // *************************************************************************
+    // ***   Stop High Resolution PWM   ****************************************
+    // *************************************************************************
+    // Channel pin is switched back to its PWM timer
+    void StopHiresPwm();
+
+    // *************************************************************************
+    // ***   Switch PWM Pin   **************************************************
+    // *************************************************************************
+    // Pin is switched in low part of outgoing timer period and free running
+    // incoming timer restarts at its falling edge, so pin outputs no runt
+    // pulse. Low part shorter than two margins is too short to hit, pin is
+    // switched at once then.
+    void SwitchPwmPin(uint8_t ch, TIM_HandleTypeDef& from_htim, uint32_t from_channel,
+                      TIM_HandleTypeDef& to_htim, uint32_t to_channel, uint8_t af, uint32_t speed);
+
+    // *************************************************************************
+    // ***   PlanPwmTimer   ****************************************************
+    // *************************************************************************
+    // Returns true if APB2 timer gives finer edge step than channel timer
+    bool PlanPwmTimer(uint8_t ch, uint32_t freq, TrigType trig);
+
+    // *************************************************************************
+    // ***   Setup Step Stream   ***********************************************
+    // *************************************************************************
+    // Step pulses with velocity ramps, direction is set on direction pin of
+    // the channel before the first step
+    Result SetupStepStream(TIM_HandleTypeDef& htim, uint32_t channel, uint8_t ch);
+
+    // *************************************************************************
+    // ***   Setup Interleaved PWM Bank   **************************************
+    // *************************************************************************
+    // Retime waits until all outputs are low, then master stops and restarts
+    // all counters together. Duty change only reloads compare values between
+    // pulses, so no pulse is cut.
+    Result SetupPhaseBank(uint8_t ch);
+
+    // *************************************************************************
+    // ***   Setup Interleaved PWM Bank Counter   ******************************
+    // *************************************************************************
+    void SetupPhaseCounter(uint32_t idx, uint32_t ccr);
+
+    // *************************************************************************
+    // ***   Load Interleaved PWM Bank Compare Values   ************************
+    // *************************************************************************
+    void LoadPhaseCompare(uint32_t idx, uint32_t ccr);
+
+    // *************************************************************************
+    // ***   Write Interleaved PWM Bank Compare Preload   **********************
+    // *************************************************************************
+    // Value is written while counter runs down or up so the next update event
+    // loads it between pulses of output
+    void WritePhaseCompare(uint32_t idx, uint32_t channel, uint32_t ccr, bool down);
+
+    // *************************************************************************
+    // ***   Halt Interleaved PWM Bank   ***************************************
+    // *************************************************************************
+    // Outputs finish their pulses and stay low, then master stops all counters
+    void HaltPhaseBank();
+
+    // *************************************************************************
+    // ***   Stop Interleaved PWM Bank Counter   *******************************
+    // *************************************************************************
+    void StopPhaseCounter(uint32_t idx);
+
+    // *************************************************************************
+    // ***   Set Interleaved PWM Bank Partner Pin   ****************************
+    // *************************************************************************
+    // PB11 is TIM2_CH4 while bank uses it, pattern generator output otherwise
+    static void SetPhasePartnerPin(bool bank);
+
+    // *************************************************************************
+    // ***   Stop Interleaved PWM Bank   ***************************************
+    // *************************************************************************
+    // Timers are returned to channel setup and slave channel is re-applied
+    void StopPhaseBank();
+
+    // *************************************************************************
+    // ***   PlanPhases   ******************************************************
+    // *************************************************************************
+    // Assigns phases to counters: phase half period after valley of used
+    // counter is its partner, other phases need new counter. Returns false if
+    // counters aren't enough.
+    static bool PlanPhases(uint8_t cnt, uint32_t spacing, PhaseBankType& plan);
+
+    // *************************************************************************
+    // ***   Stop Stream   *****************************************************
+    // *************************************************************************
+    void StopStream(uint8_t ch);
+
+    // *************************************************************************
+    // ***   FillDacBlock   ****************************************************
+    // *************************************************************************
+    void FillDacBlock(uint8_t ch, uint16_t* buf);
+
+    // *************************************************************************
+    // ***   FillNoiseBlock   **************************************************
+    // *************************************************************************
+    void FillNoiseBlock(uint8_t ch, uint16_t* buf);
+
+    // *************************************************************************
+    // ***   FillPwmBlock   ****************************************************
+    // *************************************************************************
+    void FillPwmBlock(uint8_t ch, uint32_t start, uint32_t cnt);
+
+    // *************************************************************************
+    // ***   FillPrbsBlock   ***************************************************
+    // *************************************************************************
+    void FillPrbsBlock(uint8_t ch, uint32_t start, uint32_t cnt);
+
+    // *************************************************************************
+    // ***   SetPwmStreamFrequency   *******************************************
+    // *************************************************************************
+    void SetPwmStreamFrequency(PwmStreamType& stream, float freq);
+
+    // *************************************************************************
+    // ***   ArmTrigger   ******************************************************
+    // *************************************************************************
+    void ArmTrigger(uint8_t ch, TIM_HandleTypeDef& htim, uint32_t channel, TrigType trig);
+
+    // *************************************************************************
+    // ***   LoadPwm   *********************************************************
+    // *************************************************************************
+    // Set period and compare value of free running PWM without runt pulses
+    static void LoadPwm(TIM_HandleTypeDef& htim, uint32_t channel, uint32_t arr, uint32_t ccr);
+
+    // *************************************************************************
+    // ***   StopPwmAtUpdate   *************************************************
+    // *************************************************************************
+    // Stop counter at the end of current period with inactive output
+    static void StopPwmAtUpdate(TIM_HandleTypeDef& htim, uint32_t channel);
+
+    // *************************************************************************
+    // ***   StartPwmOutput   **************************************************
+    // *************************************************************************
+    static void StartPwmOutput(TIM_HandleTypeDef& htim, uint32_t channel);
+
+    // *************************************************************************
+    // ***   IsPwmFreeRunning   ************************************************
+    // *************************************************************************
+    static bool IsPwmFreeRunning(TIM_TypeDef* tim, uint32_t channel);
+
+    // *************************************************************************
+    // ***   GetOcMode   *******************************************************
+    // *************************************************************************
+    // Output compare mode and preload enable bits
+    static uint32_t GetOcMode(TIM_TypeDef* tim, uint32_t channel);
+
+    // *************************************************************************
+    // ***   SetOcMode   *******************************************************
+    // *************************************************************************
+    static void SetOcMode(TIM_TypeDef* tim, uint32_t channel, uint32_t oc_mode);
 
     // *************************************************************************
     // ***   IsAnalogChannel   *************************************************
     // *************************************************************************
-    static bool IsAnalogChannel(uint8_t ch) {return ((ch < 2U) ? true : false);}
+    static bool IsAnalogChannel(uint8_t ch) {return CHANNEL_HW[ch].analog;}
+
+    // *************************************************************************
+    // ***   IsPwmDac   ********************************************************
+    // *************************************************************************
+    // Digital channel outputs waveform other than square as filtered PWM
+    bool IsPwmDac(uint8_t ch) {return (!IsAnalogChannel(ch) && (ch_dsc[ch].waveform != WAVEFORM_SQUARE));}
+
+    // *************************************************************************
+    // ***   GetMaxFrequency   *************************************************
+    // *************************************************************************
+    int32_t GetMaxFrequency(uint8_t ch)
+    {
+      if(IsAnalogChannel(ch)) return MAX_ANALOG_FREQ;
+      else if(IsPwmDac(ch))   return MAX_PWM_DAC_FREQ;
+      else                    return MAX_DIGITAL_FREQ;
+    }
+
+    // *************************************************************************
+    // ***   GetMaxDuty   ******************************************************
+    // *************************************************************************
+    static int32_t GetMaxDuty(uint8_t ch) {return (IsAnalogChannel(ch) ? DUTY_FULL : DUTY_FULL - 1);}
+
+    // *************************************************************************
+    // ***   GetPwmClock   *****************************************************
+    // *************************************************************************
+    // TIM2 and TIM5 are clocked from APB1 timer clock
+    static uint32_t GetPwmClock() {return HAL_RCC_GetPCLK1Freq() * 2U;}
+
+    // *************************************************************************
+    // ***   GetComplClock   ***************************************************
+    // *************************************************************************
+    // TIM1 is clocked from APB2 timer clock
+    static uint32_t GetComplClock() {return HAL_RCC_GetPCLK2Freq() * 2U;}
+
+    // *************************************************************************
+    // ***   GetHiresClock   ***************************************************
+    // *************************************************************************
+    // TIM9 is clocked from APB2 timer clock
+    static uint32_t GetHiresClock() {return HAL_RCC_GetPCLK2Freq() * 2U;}
+
+    // *************************************************************************
+    // ***   GetChannelPwmClock   **********************************************
+    // *************************************************************************
+    // Clock of timer that outputs PWM of digital channel now
+    uint32_t GetChannelPwmClock(uint8_t ch) {return (hires_ch == ch) ? GetHiresClock() : GetPwmClock();}
+
+    // *************************************************************************
+    // ***   IsComplBreak   ****************************************************
+    // *************************************************************************
+    // Break input disabled complementary outputs
+    bool IsComplBreak() {return ((compl_ch < CHANNEL_CNT) && ((htim1.Instance->BDTR & TIM_BDTR_MOE) == 0U));}
+
+    // *************************************************************************
+    // ***   IsComplUsed   *****************************************************
+    // *************************************************************************
+    // Other channel outputs or requested complementary PWM
+    bool IsComplUsed(uint8_t ch);
+
+    // *************************************************************************
+    // ***   GetBurstPeriod   **************************************************
+    // *************************************************************************
+    // Burst period in ms that is output: requested period is extended if
+    // burst cycles and one idle sample or PWM period don't fit into it
+    uint32_t GetBurstPeriod(uint8_t ch);
+
+    // *************************************************************************
+    // ***   IsPhaseSlave   ****************************************************
+    // *************************************************************************
+    // Channel timer is taken by interleaved PWM bank
+    bool IsPhaseSlave(uint8_t ch) {return ((ch == PHASE_SLAVE_CHANNEL) && phase_bank.active);}
+
+    // *************************************************************************
+    // ***   IsStepMoving   ****************************************************
+    // *************************************************************************
+    // Stepper move isn't finished until DMA buffer holds only idle periods
+    bool IsStepMoving(uint8_t ch);
+
+    // *************************************************************************
+    // ***   GetPhaseSpacing   *************************************************
+    // *************************************************************************
+    // Spacing in millidegrees, zero means evenly spaced phases
+    static uint32_t GetPhaseSpacing(uint8_t cnt, uint32_t spacing) {return ((spacing == 0U) ? (360000U / cnt) : spacing);}
+
+    // *************************************************************************
+    // ***   DeadTimeToDtg   ***************************************************
+    // *************************************************************************
+    // Dead-time generator value for dead-time in timer clocks, rounded down.
+    // Dead-time actually inserted in clocks is returned in dt.
+    static uint32_t DeadTimeToDtg(uint32_t clocks, uint32_t& dt);
+
+    // *************************************************************************
+    // ***   GetPwmArr   *******************************************************
+    // *************************************************************************
+    static uint32_t GetPwmArr(uint32_t freq) {return GetPwmClock() / freq - 1U;}
+
+    // *************************************************************************
+    // ***   GetPrbsArr   ******************************************************
+    // *************************************************************************
+    // Bit period rounded to the nearest timer count, rate is limited
+    static uint32_t GetPrbsArr(uint32_t rate) {if(rate > (uint32_t)MAX_PRBS_RATE) rate = MAX_PRBS_RATE;
+                                               return (GetPwmClock() + rate / 2U) / rate - 1U;}
+
+    // *************************************************************************
+    // ***   DutyToCcr   *******************************************************
+    // *************************************************************************
+    // Compare value is kept inside period, so output always has both edges
+    static uint32_t DutyToCcr(uint32_t arr, int32_t duty)
+    {
+      uint32_t ccr = ((uint64_t)(arr + 1U) * duty) / DUTY_FULL;
+      if(ccr < 1U) ccr = 1U;
+      if(ccr > arr) ccr = arr;
+      return ccr;
+    }
+
+    // *************************************************************************
+    // ***   DutyToFrac   ******************************************************
+    // *************************************************************************
+    // Duty as Q32 fraction of period for compare values computed per period
+    static uint32_t DutyToFrac(int32_t duty) {return (uint32_t)(((uint64_t)duty << 32U) / DUTY_FULL);}
+
+    // *************************************************************************
+    // ***   FracToCcr   *******************************************************
+    // *************************************************************************
+    // Compare value of DutyToCcr within one count(fraction is rounded down)
+    // with one 32x32 multiply instead of 64-bit division
+    static uint32_t FracToCcr(uint32_t arr, uint32_t frac)
+    {
+      uint32_t ccr = ((uint64_t)(arr + 1U) * frac) >> 32U;
+      if(ccr < 1U) ccr = 1U;
+      if(ccr > arr) ccr = arr;
+      return ccr;
+    }
+
+    // *************************************************************************
+    // ***   GetPwmDacLen   ****************************************************
+    // *************************************************************************
+    // Samples in PWM-DAC period: as many as stream buffer holds, but every
+    // sample is at least PWM_DAC_MIN_CNT timer counts
+    static uint32_t GetPwmDacLen(uint32_t freq)
+    {
+      uint32_t len = GetPwmClock() / PWM_DAC_MIN_CNT / freq;
+      if(len > PWM_STREAM_LEN * PWM_BURST_MAX_LEN) len = PWM_STREAM_LEN * PWM_BURST_MAX_LEN;
+      return len;
+    }
+
+    // *************************************************************************
+    // ***   GetDitherCnt   ****************************************************
+    // *************************************************************************
+    // Timer counts of active output in whole dither sequence. Every period
+    // keeps both edges, so compare value stays in 1..ARR range.
+    static uint32_t GetDitherCnt(uint32_t arr, int32_t duty)
+    {
+      uint64_t cnt = ((uint64_t)(arr + 1U) * DITHER_LEN * duty + DUTY_FULL / 2) / DUTY_FULL;
+      if(cnt < DITHER_LEN) cnt = DITHER_LEN;
+      if(cnt > (uint64_t)arr * DITHER_LEN) cnt = (uint64_t)arr * DITHER_LEN;
+      return cnt;
+    }
+
+    // *************************************************************************
+    // ***   IsModulationMode   ************************************************
+    // *************************************************************************
+    static bool IsModulationMode(ModeType mode) {return ((mode == MODE_AM) || (mode == MODE_FM) || (mode == MODE_PM));}
+
+    // *************************************************************************
+    // ***   Xorshift32   ******************************************************
+    // *************************************************************************
+    // Marsaglia xorshift PRNG, period 2^32 - 1, state must not be zero
+    static uint32_t Xorshift32(uint32_t x) {x ^= x << 13U; x ^= x >> 17U; x ^= x << 5U; return x;}
+
+    // *************************************************************************
+    // ***   ParamChanged   ****************************************************
+    // *************************************************************************
+    // Add parameter to FNV-1a signature and compare it with applied value
+    static bool ParamChanged(uint32_t& sig, int64_t value, int64_t applied) {sig = (sig ^ (uint32_t)value) * 16777619U;
+                                                                             sig = (sig ^ (uint32_t)(value >> 32U)) * 16777619U;
+                                                                             return (value != applied);}
 
     // *************************************************************************
     // ***   Private constructor   *********************************************
@@ -29,8 +29,11 @@
 
 // *** Applications tasks stack sizes   ****************************************
 #define APPLICATION_TASK_STACK_SIZE 1024u
+#define PATTERNGEN_TASK_STACK_SIZE 512u
 // *** Applications tasks priorities   *****************************************
 #define APPLICATION_TASK_PRIORITY (tskIDLE_PRIORITY + 2u)
+// Pattern stream refill must preempt UI
+#define PATTERNGEN_TASK_PRIORITY (tskIDLE_PRIORITY + 3u)
 
 // *****************************************************************************
 // ***   Display Configuration   ***********************************************
@@ -61,3 +64,9 @@ static constexpr bool DISPLAY_DEBUG_INFO = false;
 static constexpr bool DISPLAY_DEBUG_AREA = false;
 static constexpr bool DISPLAY_DEBUG_TOUCH = false;
 
+// *****************************************************************************
+// ***   Application Configuration   *******************************************
+// *****************************************************************************
+
+// Application debug info(count of dropped generator updates, etc.)
+static constexpr bool APPLICATION_DEBUG_INFO = false;
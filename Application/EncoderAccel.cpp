@@ -0,0 +1,98 @@
+//******************************************************************************
+//  @file EncoderAccel.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details Application: Encoder Acceleration Class, implementation
+//
+//  @copyright Copyright (c) 2016, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "EncoderAccel.h"
+
+// *****************************************************************************
+// ***   Acceleration table   **************************************************
+// *****************************************************************************
+const EncoderAccel::AccelEntryType EncoderAccel::ACCEL_TABLE[] =
+{
+  { 0U,  1U},
+  {15U,  2U},
+  {25U,  5U},
+  {40U, 10U},
+  {60U, 25U}
+};
+
+// *****************************************************************************
+// ***   Process   *************************************************************
+// *****************************************************************************
+int32_t EncoderAccel::Process(int32_t steps, uint32_t time_ms)
+{
+  uint32_t dt = time_ms - last_time_ms;
+  last_time_ms = time_ms;
+
+  if(steps == 0)
+  {
+    // Encoder stopped - reset speed
+    if(time_ms - last_step_ms >= IDLE_TIME_MS)
+    {
+      Reset();
+    }
+  }
+  else
+  {
+    int32_t dir = (steps > 0) ? 1 : -1;
+    uint32_t abs_steps = (uint32_t)(steps * dir);
+    // Speed of this poll cycle. Interval of IDLE_TIME_MS or more means that
+    // Process() wasn't called for a while(first call or paused polling), so
+    // steps are spread over unknown time and cycle counts as slow. Zero
+    // interval(two calls in the same millisecond) is skipped too.
+    uint32_t cur_speed = 0U;
+    if((dt > 0U) && (dt < IDLE_TIME_MS))
+    {
+      cur_speed = (abs_steps * 1000U) / dt;
+    }
+    // Change of direction - start from slow speed to allow fine correction
+    if(dir != last_dir)
+    {
+      speed = 0U;
+    }
+    // Simple filter to smooth uneven rotation
+    speed = (speed + cur_speed) / 2U;
+    // Find multiplier
+    multiplier = 1U;
+    for(uint32_t i = 0U; i < sizeof(ACCEL_TABLE) / sizeof(ACCEL_TABLE[0U]); i++)
+    {
+      if(speed >= ACCEL_TABLE[i].speed)
+      {
+        multiplier = ACCEL_TABLE[i].multiplier;
+      }
+    }
+    // Save state
+    last_dir = dir;
+    last_step_ms = time_ms;
+    // Scale steps
+    steps *= (int32_t)multiplier;
+  }
+
+  return steps;
+}
+
+// *****************************************************************************
+// ***   Reset   ***************************************************************
+// *****************************************************************************
+void EncoderAccel::Reset()
+{
+  speed = 0U;
+  multiplier = 1U;
+  last_dir = 0;
+}
@@ -0,0 +1,85 @@
+//******************************************************************************
+//  @file EncoderAccel.h
+//  @author Nicolai Shlapunov
+//
+//  @details Application: Encoder Acceleration Class, header
+//
+//  @copyright Copyright (c) 2016, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef EncoderAccel_h
+#define EncoderAccel_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include <cstdint>
+
+// *****************************************************************************
+// ***   EncoderAccel Class   **************************************************
+// *****************************************************************************
+//
+// Scales encoder steps by rotation speed. Speed calculated from steps count
+// between calls, so Process() should be called every poll cycle even if there
+// is no steps. Slow rotation gives one step per detent, fast rotation gives up
+// to MAX multiplier steps per detent. Change of direction resets speed, so it
+// is easy to make fine correction after overshoot.
+//
+class EncoderAccel
+{
+  public:
+    // *************************************************************************
+    // ***   Process   *********************************************************
+    // *************************************************************************
+    int32_t Process(int32_t steps, uint32_t time_ms);
+
+    // *************************************************************************
+    // ***   Reset   ***********************************************************
+    // *************************************************************************
+    void Reset();
+
+    // *************************************************************************
+    // ***   GetSpeed   ********************************************************
+    // *************************************************************************
+    uint32_t GetSpeed() {return speed;}
+
+    // *************************************************************************
+    // ***   GetMultiplier   ***************************************************
+    // *************************************************************************
+    uint32_t GetMultiplier() {return multiplier;}
+
+  private:
+    // Structure for acceleration table entry
+    typedef struct
+    {
+      uint32_t speed;      // Minimum speed in detents per second
+      uint32_t multiplier; // Steps per detent
+    } AccelEntryType;
+
+    // Acceleration table
+    static const AccelEntryType ACCEL_TABLE[];
+
+    // Time without steps after which speed is reset
+    static const uint32_t IDLE_TIME_MS = 300U;
+
+    // Filtered speed in detents per second
+    uint32_t speed = 0U;
+    // Current multiplier
+    uint32_t multiplier = 1U;
+    // Time of last call
+    uint32_t last_time_ms = 0U;
+    // Time of last step
+    uint32_t last_step_ms = 0U;
+    // Direction of last step
+    int32_t last_dir = 0;
+};
+
+#endif
@@ -1,1077 +1,417 @@
+const uint16_t waveforms_0_line[] = {
+0, 2, 8, 14, 20, 34, 60, 82, 104, 126, 148, 169, 190, 210, 230, 250,
+269, 288, 307, 326, 345, 364, 382, 400, 418, 436, 454, 472, 490, 508, 526, 544,
+562, 580, 598, 616, 635, 654, 673, 692, 711, 730, 750, 770, 790, 811, 832, 854,
+876, 898, 920, 946, 960, 966, 972, 978};
+
 const uint8_t waveforms_0_data[] = {
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x38, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x38, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x38, 0x10, 0x10, 0x10, 0x38, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x38, 0x10, 0x10, 0x10, 0x38, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x38, 0x10, 0x10, 0x10, 0x38, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x38, 0x10, 0x10, 0x10, 0x38, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x38, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x38, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B};
+0xCB, 0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B,
+0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x86, 0x10, 0x82, 0x38, 0xA2, 0x10, 0x82, 0x38, 0x99, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x01, 0x38, 0x38, 0x82, 0x10, 0x01, 0x38, 0x38, 0x9E, 0x10,
+0x01, 0x38, 0x38, 0x82, 0x10, 0x01, 0x38, 0x38, 0x97, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x83, 0x10,
+0x00, 0x38, 0x86, 0x10, 0x00, 0x38, 0x9C, 0x10, 0x00, 0x38, 0x86, 0x10, 0x00, 0x38, 0x96, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0x83, 0x10, 0x00, 0x38, 0x86, 0x10, 0x00, 0x38, 0x9C, 0x10, 0x00, 0x38,
+0x86, 0x10, 0x00, 0x38, 0x96, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x82, 0x10, 0x00, 0x38, 0x88, 0x10,
+0x00, 0x38, 0x9A, 0x10, 0x00, 0x38, 0x88, 0x10, 0x00, 0x38, 0x95, 0x10, 0x00, 0x5B, 0x00, 0x5B,
+0x82, 0x10, 0x00, 0x38, 0x88, 0x10, 0x00, 0x38, 0x9A, 0x10, 0x00, 0x38, 0x88, 0x10, 0x00, 0x38,
+0x95, 0x10, 0x00, 0x5B, 0x03, 0x5B, 0x10, 0x10, 0x38, 0x8A, 0x10, 0x00, 0x38, 0x98, 0x10, 0x00,
+0x38, 0x8A, 0x10, 0x00, 0x38, 0x94, 0x10, 0x00, 0x5B, 0x03, 0x5B, 0x10, 0x10, 0x38, 0x8A, 0x10,
+0x00, 0x38, 0x98, 0x10, 0x00, 0x38, 0x8A, 0x10, 0x00, 0x38, 0x94, 0x10, 0x00, 0x5B, 0x02, 0x5B,
+0x10, 0x38, 0x8C, 0x10, 0x00, 0x38, 0x96, 0x10, 0x00, 0x38, 0x8C, 0x10, 0x00, 0x38, 0x93, 0x10,
+0x00, 0x5B, 0x02, 0x5B, 0x10, 0x38, 0x8C, 0x10, 0x00, 0x38, 0x96, 0x10, 0x00, 0x38, 0x8C, 0x10,
+0x00, 0x38, 0x93, 0x10, 0x00, 0x5B, 0x02, 0x5B, 0x10, 0x38, 0x8C, 0x10, 0x00, 0x38, 0x96, 0x10,
+0x00, 0x38, 0x8C, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x5B, 0x01, 0x5B, 0x38, 0x8E, 0x10, 0x00,
+0x38, 0x94, 0x10, 0x00, 0x38, 0x8E, 0x10, 0x00, 0x38, 0x92, 0x10, 0x00, 0x5B, 0x01, 0x5B, 0x38,
+0x8E, 0x10, 0x00, 0x38, 0x94, 0x10, 0x00, 0x38, 0x8E, 0x10, 0x00, 0x38, 0x92, 0x10, 0x00, 0x5B,
+0x01, 0x5B, 0x38, 0x8E, 0x10, 0x00, 0x38, 0x94, 0x10, 0x00, 0x38, 0x8E, 0x10, 0x00, 0x38, 0x92,
+0x10, 0x00, 0x5B, 0x01, 0x5B, 0x38, 0x8E, 0x10, 0x00, 0x38, 0x94, 0x10, 0x00, 0x38, 0x8E, 0x10,
+0x00, 0x38, 0x92, 0x10, 0x00, 0x5B, 0x01, 0x5B, 0x38, 0x8E, 0x10, 0x00, 0x38, 0x94, 0x10, 0x00,
+0x38, 0x8E, 0x10, 0x00, 0x38, 0x92, 0x10, 0x00, 0x5B, 0x01, 0x5B, 0x38, 0x8E, 0x10, 0x00, 0x38,
+0x94, 0x10, 0x00, 0x38, 0x8E, 0x10, 0x00, 0x38, 0x92, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x90, 0x10,
+0x00, 0x38, 0x92, 0x10, 0x00, 0x38, 0x90, 0x10, 0x00, 0x38, 0x91, 0x10, 0x00, 0x5B, 0x00, 0x5B,
+0x90, 0x10, 0x00, 0x38, 0x92, 0x10, 0x00, 0x38, 0x90, 0x10, 0x00, 0x38, 0x91, 0x10, 0x00, 0x5B,
+0x00, 0x5B, 0x90, 0x10, 0x00, 0x38, 0x92, 0x10, 0x00, 0x38, 0x90, 0x10, 0x00, 0x38, 0x91, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0x90, 0x10, 0x00, 0x38, 0x92, 0x10, 0x00, 0x38, 0x90, 0x10, 0x00, 0x38,
+0x91, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x90, 0x10, 0x00, 0x38, 0x92, 0x10, 0x00, 0x38, 0x90, 0x10,
+0x00, 0x38, 0x91, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x90, 0x10, 0x00, 0x38, 0x92, 0x10, 0x00, 0x38,
+0x90, 0x10, 0x00, 0x38, 0x91, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x90, 0x10, 0x00, 0x38, 0x92, 0x10,
+0x00, 0x38, 0x90, 0x10, 0x00, 0x38, 0x91, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x91, 0x10, 0x00, 0x38,
+0x90, 0x10, 0x00, 0x38, 0x92, 0x10, 0x00, 0x38, 0x90, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x91, 0x10,
+0x00, 0x38, 0x90, 0x10, 0x00, 0x38, 0x92, 0x10, 0x00, 0x38, 0x90, 0x10, 0x00, 0x5B, 0x00, 0x5B,
+0x91, 0x10, 0x00, 0x38, 0x90, 0x10, 0x00, 0x38, 0x92, 0x10, 0x00, 0x38, 0x90, 0x10, 0x00, 0x5B,
+0x00, 0x5B, 0x91, 0x10, 0x00, 0x38, 0x90, 0x10, 0x00, 0x38, 0x92, 0x10, 0x00, 0x38, 0x90, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0x91, 0x10, 0x00, 0x38, 0x90, 0x10, 0x00, 0x38, 0x92, 0x10, 0x00, 0x38,
+0x90, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x91, 0x10, 0x00, 0x38, 0x90, 0x10, 0x00, 0x38, 0x92, 0x10,
+0x00, 0x38, 0x90, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x91, 0x10, 0x00, 0x38, 0x90, 0x10, 0x00, 0x38,
+0x92, 0x10, 0x00, 0x38, 0x90, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x92, 0x10, 0x00, 0x38, 0x8E, 0x10,
+0x00, 0x38, 0x94, 0x10, 0x00, 0x38, 0x8E, 0x10, 0x01, 0x38, 0x5B, 0x00, 0x5B, 0x92, 0x10, 0x00,
+0x38, 0x8E, 0x10, 0x00, 0x38, 0x94, 0x10, 0x00, 0x38, 0x8E, 0x10, 0x01, 0x38, 0x5B, 0x00, 0x5B,
+0x92, 0x10, 0x00, 0x38, 0x8E, 0x10, 0x00, 0x38, 0x94, 0x10, 0x00, 0x38, 0x8E, 0x10, 0x01, 0x38,
+0x5B, 0x00, 0x5B, 0x92, 0x10, 0x00, 0x38, 0x8E, 0x10, 0x00, 0x38, 0x94, 0x10, 0x00, 0x38, 0x8E,
+0x10, 0x01, 0x38, 0x5B, 0x00, 0x5B, 0x92, 0x10, 0x00, 0x38, 0x8E, 0x10, 0x00, 0x38, 0x94, 0x10,
+0x00, 0x38, 0x8E, 0x10, 0x01, 0x38, 0x5B, 0x00, 0x5B, 0x92, 0x10, 0x00, 0x38, 0x8E, 0x10, 0x00,
+0x38, 0x94, 0x10, 0x00, 0x38, 0x8E, 0x10, 0x01, 0x38, 0x5B, 0x00, 0x5B, 0x93, 0x10, 0x00, 0x38,
+0x8C, 0x10, 0x00, 0x38, 0x96, 0x10, 0x00, 0x38, 0x8C, 0x10, 0x02, 0x38, 0x10, 0x5B, 0x00, 0x5B,
+0x93, 0x10, 0x00, 0x38, 0x8C, 0x10, 0x00, 0x38, 0x96, 0x10, 0x00, 0x38, 0x8C, 0x10, 0x02, 0x38,
+0x10, 0x5B, 0x00, 0x5B, 0x93, 0x10, 0x00, 0x38, 0x8C, 0x10, 0x00, 0x38, 0x96, 0x10, 0x00, 0x38,
+0x8C, 0x10, 0x02, 0x38, 0x10, 0x5B, 0x00, 0x5B, 0x94, 0x10, 0x00, 0x38, 0x8A, 0x10, 0x00, 0x38,
+0x98, 0x10, 0x00, 0x38, 0x8A, 0x10, 0x03, 0x38, 0x10, 0x10, 0x5B, 0x00, 0x5B, 0x94, 0x10, 0x00,
+0x38, 0x8A, 0x10, 0x00, 0x38, 0x98, 0x10, 0x00, 0x38, 0x8A, 0x10, 0x03, 0x38, 0x10, 0x10, 0x5B,
+0x00, 0x5B, 0x95, 0x10, 0x00, 0x38, 0x88, 0x10, 0x00, 0x38, 0x9A, 0x10, 0x00, 0x38, 0x88, 0x10,
+0x00, 0x38, 0x82, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x95, 0x10, 0x00, 0x38, 0x88, 0x10, 0x00, 0x38,
+0x9A, 0x10, 0x00, 0x38, 0x88, 0x10, 0x00, 0x38, 0x82, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x96, 0x10,
+0x00, 0x38, 0x86, 0x10, 0x00, 0x38, 0x9C, 0x10, 0x00, 0x38, 0x86, 0x10, 0x00, 0x38, 0x83, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0x96, 0x10, 0x00, 0x38, 0x86, 0x10, 0x00, 0x38, 0x9C, 0x10, 0x00, 0x38,
+0x86, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x97, 0x10, 0x01, 0x38, 0x38, 0x82,
+0x10, 0x01, 0x38, 0x38, 0x9E, 0x10, 0x01, 0x38, 0x38, 0x82, 0x10, 0x01, 0x38, 0x38, 0x84, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0x99, 0x10, 0x82, 0x38, 0xA2, 0x10, 0x82, 0x38, 0x86, 0x10, 0x00, 0x5B,
+0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0xC9, 0x10,
+0x00, 0x5B, 0xCB, 0x5B};
+
+const uint16_t waveforms_1_line[] = {
+0, 2, 8, 14, 20, 34, 52, 70, 92, 114, 136, 158, 180, 202, 224, 246,
+268, 290, 312, 334, 356, 378, 400, 422, 444, 466, 488, 510, 532, 554, 576, 598,
+620, 642, 664, 686, 708, 730, 752, 774, 796, 818, 840, 862, 884, 906, 928, 950,
+971, 992, 1009, 1026, 1039, 1045, 1051, 1057};
 
 const uint8_t waveforms_1_data[] = {
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x38, 0x5B, 0x5B, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x38, 0x5B, 0x5B, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B};
+0xCB, 0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B,
+0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x91, 0x10, 0x00, 0x38, 0xA2, 0x10, 0x00, 0x38, 0x92, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0x90, 0x10, 0x02, 0x38, 0x10, 0x38, 0xA0, 0x10, 0x02, 0x38, 0x10, 0x38,
+0x91, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x90, 0x10, 0x02, 0x38, 0x10, 0x38, 0xA0, 0x10, 0x02, 0x38,
+0x10, 0x38, 0x91, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x8F, 0x10, 0x00, 0x38, 0x82, 0x10, 0x00, 0x38,
+0x9E, 0x10, 0x00, 0x38, 0x82, 0x10, 0x00, 0x38, 0x90, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x8F, 0x10,
+0x00, 0x38, 0x82, 0x10, 0x00, 0x38, 0x9E, 0x10, 0x00, 0x38, 0x82, 0x10, 0x00, 0x38, 0x90, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0x8E, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x38, 0x9C, 0x10, 0x00, 0x38,
+0x84, 0x10, 0x00, 0x38, 0x8F, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x8E, 0x10, 0x00, 0x38, 0x84, 0x10,
+0x00, 0x38, 0x9C, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x38, 0x8F, 0x10, 0x00, 0x5B, 0x00, 0x5B,
+0x8E, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x38, 0x9C, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x38,
+0x8F, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x8D, 0x10, 0x00, 0x38, 0x86, 0x10, 0x00, 0x38, 0x9A, 0x10,
+0x00, 0x38, 0x86, 0x10, 0x00, 0x38, 0x8E, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x8D, 0x10, 0x00, 0x38,
+0x86, 0x10, 0x00, 0x38, 0x9A, 0x10, 0x00, 0x38, 0x86, 0x10, 0x00, 0x38, 0x8E, 0x10, 0x00, 0x5B,
+0x00, 0x5B, 0x8D, 0x10, 0x00, 0x38, 0x86, 0x10, 0x00, 0x38, 0x9A, 0x10, 0x00, 0x38, 0x86, 0x10,
+0x00, 0x38, 0x8E, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x8C, 0x10, 0x00, 0x38, 0x88, 0x10, 0x00, 0x38,
+0x98, 0x10, 0x00, 0x38, 0x88, 0x10, 0x00, 0x38, 0x8D, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x8C, 0x10,
+0x00, 0x38, 0x88, 0x10, 0x00, 0x38, 0x98, 0x10, 0x00, 0x38, 0x88, 0x10, 0x00, 0x38, 0x8D, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0x8C, 0x10, 0x00, 0x38, 0x88, 0x10, 0x00, 0x38, 0x98, 0x10, 0x00, 0x38,
+0x88, 0x10, 0x00, 0x38, 0x8D, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x8B, 0x10, 0x00, 0x38, 0x8A, 0x10,
+0x00, 0x38, 0x96, 0x10, 0x00, 0x38, 0x8A, 0x10, 0x00, 0x38, 0x8C, 0x10, 0x00, 0x5B, 0x00, 0x5B,
+0x8B, 0x10, 0x00, 0x38, 0x8A, 0x10, 0x00, 0x38, 0x96, 0x10, 0x00, 0x38, 0x8A, 0x10, 0x00, 0x38,
+0x8C, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x8B, 0x10, 0x00, 0x38, 0x8A, 0x10, 0x00, 0x38, 0x96, 0x10,
+0x00, 0x38, 0x8A, 0x10, 0x00, 0x38, 0x8C, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x8A, 0x10, 0x00, 0x38,
+0x8C, 0x10, 0x00, 0x38, 0x94, 0x10, 0x00, 0x38, 0x8C, 0x10, 0x00, 0x38, 0x8B, 0x10, 0x00, 0x5B,
+0x00, 0x5B, 0x8A, 0x10, 0x00, 0x38, 0x8C, 0x10, 0x00, 0x38, 0x94, 0x10, 0x00, 0x38, 0x8C, 0x10,
+0x00, 0x38, 0x8B, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x89, 0x10, 0x00, 0x38, 0x8E, 0x10, 0x00, 0x38,
+0x92, 0x10, 0x00, 0x38, 0x8E, 0x10, 0x00, 0x38, 0x8A, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x89, 0x10,
+0x00, 0x38, 0x8E, 0x10, 0x00, 0x38, 0x92, 0x10, 0x00, 0x38, 0x8E, 0x10, 0x00, 0x38, 0x8A, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0x89, 0x10, 0x00, 0x38, 0x8E, 0x10, 0x00, 0x38, 0x92, 0x10, 0x00, 0x38,
+0x8E, 0x10, 0x00, 0x38, 0x8A, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x88, 0x10, 0x00, 0x38, 0x90, 0x10,
+0x00, 0x38, 0x90, 0x10, 0x00, 0x38, 0x90, 0x10, 0x00, 0x38, 0x89, 0x10, 0x00, 0x5B, 0x00, 0x5B,
+0x88, 0x10, 0x00, 0x38, 0x90, 0x10, 0x00, 0x38, 0x90, 0x10, 0x00, 0x38, 0x90, 0x10, 0x00, 0x38,
+0x89, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x88, 0x10, 0x00, 0x38, 0x90, 0x10, 0x00, 0x38, 0x90, 0x10,
+0x00, 0x38, 0x90, 0x10, 0x00, 0x38, 0x89, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x87, 0x10, 0x00, 0x38,
+0x92, 0x10, 0x00, 0x38, 0x8E, 0x10, 0x00, 0x38, 0x92, 0x10, 0x00, 0x38, 0x88, 0x10, 0x00, 0x5B,
+0x00, 0x5B, 0x87, 0x10, 0x00, 0x38, 0x92, 0x10, 0x00, 0x38, 0x8E, 0x10, 0x00, 0x38, 0x92, 0x10,
+0x00, 0x38, 0x88, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x87, 0x10, 0x00, 0x38, 0x92, 0x10, 0x00, 0x38,
+0x8E, 0x10, 0x00, 0x38, 0x92, 0x10, 0x00, 0x38, 0x88, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x86, 0x10,
+0x00, 0x38, 0x94, 0x10, 0x00, 0x38, 0x8C, 0x10, 0x00, 0x38, 0x94, 0x10, 0x00, 0x38, 0x87, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0x86, 0x10, 0x00, 0x38, 0x94, 0x10, 0x00, 0x38, 0x8C, 0x10, 0x00, 0x38,
+0x94, 0x10, 0x00, 0x38, 0x87, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x86, 0x10, 0x00, 0x38, 0x94, 0x10,
+0x00, 0x38, 0x8C, 0x10, 0x00, 0x38, 0x94, 0x10, 0x00, 0x38, 0x87, 0x10, 0x00, 0x5B, 0x00, 0x5B,
+0x85, 0x10, 0x00, 0x38, 0x96, 0x10, 0x00, 0x38, 0x8A, 0x10, 0x00, 0x38, 0x96, 0x10, 0x00, 0x38,
+0x86, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x85, 0x10, 0x00, 0x38, 0x96, 0x10, 0x00, 0x38, 0x8A, 0x10,
+0x00, 0x38, 0x96, 0x10, 0x00, 0x38, 0x86, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x85, 0x10, 0x00, 0x38,
+0x96, 0x10, 0x00, 0x38, 0x8A, 0x10, 0x00, 0x38, 0x96, 0x10, 0x00, 0x38, 0x86, 0x10, 0x00, 0x5B,
+0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x98, 0x10, 0x00, 0x38, 0x88, 0x10, 0x00, 0x38, 0x98, 0x10,
+0x00, 0x38, 0x85, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x98, 0x10, 0x00, 0x38,
+0x88, 0x10, 0x00, 0x38, 0x98, 0x10, 0x00, 0x38, 0x85, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10,
+0x00, 0x38, 0x98, 0x10, 0x00, 0x38, 0x88, 0x10, 0x00, 0x38, 0x98, 0x10, 0x00, 0x38, 0x85, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0x83, 0x10, 0x00, 0x38, 0x9A, 0x10, 0x00, 0x38, 0x86, 0x10, 0x00, 0x38,
+0x9A, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x83, 0x10, 0x00, 0x38, 0x9A, 0x10,
+0x00, 0x38, 0x86, 0x10, 0x00, 0x38, 0x9A, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B,
+0x83, 0x10, 0x00, 0x38, 0x9A, 0x10, 0x00, 0x38, 0x86, 0x10, 0x00, 0x38, 0x9A, 0x10, 0x00, 0x38,
+0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x82, 0x10, 0x00, 0x38, 0x9C, 0x10, 0x00, 0x38, 0x84, 0x10,
+0x00, 0x38, 0x9C, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x82, 0x10, 0x00, 0x38,
+0x9C, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x38, 0x9C, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B,
+0x00, 0x5B, 0x82, 0x10, 0x00, 0x38, 0x9C, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x38, 0x9C, 0x10,
+0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x03, 0x5B, 0x10, 0x10, 0x38, 0x9E, 0x10, 0x00, 0x38, 0x82,
+0x10, 0x00, 0x38, 0x9E, 0x10, 0x00, 0x38, 0x82, 0x10, 0x00, 0x5B, 0x03, 0x5B, 0x10, 0x10, 0x38,
+0x9E, 0x10, 0x00, 0x38, 0x82, 0x10, 0x00, 0x38, 0x9E, 0x10, 0x00, 0x38, 0x82, 0x10, 0x00, 0x5B,
+0x02, 0x5B, 0x10, 0x38, 0xA0, 0x10, 0x02, 0x38, 0x10, 0x38, 0xA0, 0x10, 0x03, 0x38, 0x10, 0x38,
+0x5B, 0x02, 0x5B, 0x10, 0x38, 0xA0, 0x10, 0x02, 0x38, 0x10, 0x38, 0xA0, 0x10, 0x03, 0x38, 0x10,
+0x38, 0x5B, 0x01, 0x5B, 0x38, 0xA2, 0x10, 0x00, 0x38, 0xA2, 0x10, 0x02, 0x38, 0x10, 0x5B, 0x00,
+0x5B, 0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00,
+0x5B, 0xCB, 0x5B};
+
+const uint16_t waveforms_2_line[] = {
+0, 2, 8, 14, 20, 34, 50, 66, 84, 102, 122, 144, 166, 188, 210, 232,
+254, 276, 298, 320, 342, 364, 386, 408, 430, 452, 474, 496, 518, 540, 562, 584,
+606, 628, 650, 672, 694, 716, 738, 760, 782, 804, 826, 848, 870, 892, 914, 936,
+959, 980, 999, 1016, 1031, 1037, 1043, 1049};
 
 const uint8_t waveforms_2_data[] = {
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x38, 0x5B, 
-0x5B, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x38, 0x10, 0x5B, 0x5B, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x38, 0x10, 0x10, 0x5B, 0x5B, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x38, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B};
+0xCB, 0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B,
+0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0xA1, 0x10, 0x00, 0x38, 0xA1, 0x10, 0x00, 0x38, 0x83, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0xA0, 0x10, 0x01, 0x38, 0x38, 0xA0, 0x10, 0x01, 0x38, 0x38, 0x83, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0xA0, 0x10, 0x01, 0x38, 0x38, 0xA0, 0x10, 0x01, 0x38, 0x38, 0x83, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0x9F, 0x10, 0x02, 0x38, 0x10, 0x38, 0x9F, 0x10, 0x02, 0x38, 0x10, 0x38,
+0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x9F, 0x10, 0x02, 0x38, 0x10, 0x38, 0x9F, 0x10, 0x02, 0x38,
+0x10, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x9E, 0x10, 0x03, 0x38, 0x10, 0x10, 0x38, 0x9E,
+0x10, 0x03, 0x38, 0x10, 0x10, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x9D, 0x10, 0x00, 0x38,
+0x82, 0x10, 0x00, 0x38, 0x9D, 0x10, 0x00, 0x38, 0x82, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B,
+0x00, 0x5B, 0x9D, 0x10, 0x00, 0x38, 0x82, 0x10, 0x00, 0x38, 0x9D, 0x10, 0x00, 0x38, 0x82, 0x10,
+0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x9C, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x38,
+0x9C, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x9B, 0x10,
+0x00, 0x38, 0x84, 0x10, 0x00, 0x38, 0x9B, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x38, 0x83, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0x9A, 0x10, 0x00, 0x38, 0x85, 0x10, 0x00, 0x38, 0x9A, 0x10, 0x00, 0x38,
+0x85, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x9A, 0x10, 0x00, 0x38, 0x85, 0x10,
+0x00, 0x38, 0x9A, 0x10, 0x00, 0x38, 0x85, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B,
+0x99, 0x10, 0x00, 0x38, 0x86, 0x10, 0x00, 0x38, 0x99, 0x10, 0x00, 0x38, 0x86, 0x10, 0x00, 0x38,
+0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x98, 0x10, 0x00, 0x38, 0x87, 0x10, 0x00, 0x38, 0x98, 0x10,
+0x00, 0x38, 0x87, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x97, 0x10, 0x00, 0x38,
+0x88, 0x10, 0x00, 0x38, 0x97, 0x10, 0x00, 0x38, 0x88, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B,
+0x00, 0x5B, 0x97, 0x10, 0x00, 0x38, 0x88, 0x10, 0x00, 0x38, 0x97, 0x10, 0x00, 0x38, 0x88, 0x10,
+0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x96, 0x10, 0x00, 0x38, 0x89, 0x10, 0x00, 0x38,
+0x96, 0x10, 0x00, 0x38, 0x89, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x95, 0x10,
+0x00, 0x38, 0x8A, 0x10, 0x00, 0x38, 0x95, 0x10, 0x00, 0x38, 0x8A, 0x10, 0x00, 0x38, 0x83, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0x94, 0x10, 0x00, 0x38, 0x8B, 0x10, 0x00, 0x38, 0x94, 0x10, 0x00, 0x38,
+0x8B, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x94, 0x10, 0x00, 0x38, 0x8B, 0x10,
+0x00, 0x38, 0x94, 0x10, 0x00, 0x38, 0x8B, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B,
+0x93, 0x10, 0x00, 0x38, 0x8C, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x8C, 0x10, 0x00, 0x38,
+0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x92, 0x10, 0x00, 0x38, 0x8D, 0x10, 0x00, 0x38, 0x92, 0x10,
+0x00, 0x38, 0x8D, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x91, 0x10, 0x00, 0x38,
+0x8E, 0x10, 0x00, 0x38, 0x91, 0x10, 0x00, 0x38, 0x8E, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B,
+0x00, 0x5B, 0x91, 0x10, 0x00, 0x38, 0x8E, 0x10, 0x00, 0x38, 0x91, 0x10, 0x00, 0x38, 0x8E, 0x10,
+0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x90, 0x10, 0x00, 0x38, 0x8F, 0x10, 0x00, 0x38,
+0x90, 0x10, 0x00, 0x38, 0x8F, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x8F, 0x10,
+0x00, 0x38, 0x90, 0x10, 0x00, 0x38, 0x8F, 0x10, 0x00, 0x38, 0x90, 0x10, 0x00, 0x38, 0x83, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0x8F, 0x10, 0x00, 0x38, 0x90, 0x10, 0x00, 0x38, 0x8F, 0x10, 0x00, 0x38,
+0x90, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x8E, 0x10, 0x00, 0x38, 0x91, 0x10,
+0x00, 0x38, 0x8E, 0x10, 0x00, 0x38, 0x91, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B,
+0x8D, 0x10, 0x00, 0x38, 0x92, 0x10, 0x00, 0x38, 0x8D, 0x10, 0x00, 0x38, 0x92, 0x10, 0x00, 0x38,
+0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x8C, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x8C, 0x10,
+0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x8C, 0x10, 0x00, 0x38,
+0x93, 0x10, 0x00, 0x38, 0x8C, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B,
+0x00, 0x5B, 0x8B, 0x10, 0x00, 0x38, 0x94, 0x10, 0x00, 0x38, 0x8B, 0x10, 0x00, 0x38, 0x94, 0x10,
+0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x8A, 0x10, 0x00, 0x38, 0x95, 0x10, 0x00, 0x38,
+0x8A, 0x10, 0x00, 0x38, 0x95, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x89, 0x10,
+0x00, 0x38, 0x96, 0x10, 0x00, 0x38, 0x89, 0x10, 0x00, 0x38, 0x96, 0x10, 0x00, 0x38, 0x83, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0x89, 0x10, 0x00, 0x38, 0x96, 0x10, 0x00, 0x38, 0x89, 0x10, 0x00, 0x38,
+0x96, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x88, 0x10, 0x00, 0x38, 0x97, 0x10,
+0x00, 0x38, 0x88, 0x10, 0x00, 0x38, 0x97, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B,
+0x87, 0x10, 0x00, 0x38, 0x98, 0x10, 0x00, 0x38, 0x87, 0x10, 0x00, 0x38, 0x98, 0x10, 0x00, 0x38,
+0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x86, 0x10, 0x00, 0x38, 0x99, 0x10, 0x00, 0x38, 0x86, 0x10,
+0x00, 0x38, 0x99, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x86, 0x10, 0x00, 0x38,
+0x99, 0x10, 0x00, 0x38, 0x86, 0x10, 0x00, 0x38, 0x99, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B,
+0x00, 0x5B, 0x85, 0x10, 0x00, 0x38, 0x9A, 0x10, 0x00, 0x38, 0x85, 0x10, 0x00, 0x38, 0x9A, 0x10,
+0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x9B, 0x10, 0x00, 0x38,
+0x84, 0x10, 0x00, 0x38, 0x9B, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x83, 0x10,
+0x00, 0x38, 0x9C, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x38, 0x9C, 0x10, 0x00, 0x38, 0x83, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0x83, 0x10, 0x00, 0x38, 0x9C, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x38,
+0x9C, 0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x82, 0x10, 0x00, 0x38, 0x9D, 0x10,
+0x00, 0x38, 0x82, 0x10, 0x00, 0x38, 0x9D, 0x10, 0x00, 0x38, 0x82, 0x10, 0x01, 0x38, 0x5B, 0x03,
+0x5B, 0x10, 0x10, 0x38, 0x9E, 0x10, 0x03, 0x38, 0x10, 0x10, 0x38, 0x9E, 0x10, 0x05, 0x38, 0x10,
+0x10, 0x38, 0x10, 0x5B, 0x02, 0x5B, 0x10, 0x38, 0x9F, 0x10, 0x02, 0x38, 0x10, 0x38, 0x9F, 0x10,
+0x05, 0x38, 0x10, 0x38, 0x10, 0x10, 0x5B, 0x01, 0x5B, 0x38, 0xA0, 0x10, 0x01, 0x38, 0x38, 0xA0,
+0x10, 0x01, 0x38, 0x38, 0x82, 0x10, 0x00, 0x5B, 0x01, 0x5B, 0x38, 0xA0, 0x10, 0x00, 0x38, 0xA1,
+0x10, 0x00, 0x38, 0x83, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0xC9,
+0x10, 0x00, 0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B, 0xCB, 0x5B};
+
+const uint16_t waveforms_3_line[] = {
+0, 2, 8, 14, 20, 34, 56, 78, 100, 122, 144, 166, 188, 210, 232, 254,
+276, 298, 320, 342, 364, 386, 408, 430, 452, 474, 496, 518, 540, 562, 584, 606,
+628, 650, 672, 694, 716, 738, 760, 782, 804, 826, 848, 870, 892, 914, 936, 958,
+980, 1002, 1024, 1046, 1060, 1066, 1072, 1078};
 
 const uint8_t waveforms_3_data[] = {
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 
-0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 
-0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 
-0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 
-0x38, 0x38, 0x38, 0x38, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x5B, 
-0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x5B, 0x5B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B};
+0xCB, 0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B,
+0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x95, 0x38, 0x93, 0x10, 0x95, 0x38, 0x84, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38,
+0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10,
+0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B,
+0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38,
+0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10,
+0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38,
+0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B,
+0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10,
+0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38,
+0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10,
+0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38,
+0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10,
+0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B,
+0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38,
+0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10,
+0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38,
+0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B,
+0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10,
+0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38,
+0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10,
+0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38,
+0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10,
+0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B,
+0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38,
+0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10,
+0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38,
+0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B,
+0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10,
+0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38,
+0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10,
+0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38,
+0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10,
+0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B,
+0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38,
+0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10,
+0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38,
+0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B,
+0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10,
+0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38,
+0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10,
+0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38,
+0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10,
+0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B,
+0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38,
+0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10,
+0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38,
+0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B,
+0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10,
+0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38,
+0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10,
+0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10,
+0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38,
+0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10,
+0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B,
+0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38,
+0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10,
+0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x84, 0x10, 0x00, 0x38,
+0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x84, 0x10, 0x00, 0x5B,
+0x00, 0x5B, 0x84, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10, 0x00, 0x38, 0x93, 0x10,
+0x00, 0x38, 0x84, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x85, 0x38, 0x93, 0x10, 0x95, 0x38, 0x93, 0x10,
+0x85, 0x38, 0x00, 0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B,
+0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B, 0xCB, 0x5B};
+
+const uint16_t waveforms_4_line[] = {
+0, 2, 8, 14, 20, 26, 32, 38, 44, 55, 70, 85, 100, 120, 140, 160,
+180, 205, 235, 263, 299, 337, 376, 414, 461, 519, 580, 648, 715, 786, 855, 918,
+985, 1051, 1117, 1171, 1225, 1276, 1323, 1368, 1409, 1448, 1485, 1517, 1549, 1581, 1606, 1626,
+1637, 1643, 1649, 1655, 1661, 1667, 1673, 1679};
+
+const uint8_t waveforms_4_data[] = {
+0xCB, 0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B,
+0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B,
+0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0xA6, 0x10,
+0x01, 0x38, 0x38, 0xA0, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x82, 0x10, 0x83, 0x38, 0x9F, 0x10, 0x01,
+0x38, 0x38, 0xA0, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x82, 0x10, 0x83, 0x38, 0x9F, 0x10, 0x01, 0x38,
+0x38, 0xA0, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x82, 0x10, 0x83, 0x38, 0x9F, 0x10, 0x01, 0x38, 0x38,
+0xA0, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x82, 0x10, 0x83, 0x38, 0x9F, 0x10, 0x01, 0x38, 0x38, 0x93,
+0x10, 0x01, 0x38, 0x38, 0x8A, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x82, 0x10, 0x83, 0x38, 0x9F, 0x10,
+0x01, 0x38, 0x38, 0x93, 0x10, 0x01, 0x38, 0x38, 0x8A, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x82, 0x10,
+0x83, 0x38, 0x9F, 0x10, 0x01, 0x38, 0x38, 0x93, 0x10, 0x01, 0x38, 0x38, 0x8A, 0x10, 0x00, 0x5B,
+0x00, 0x5B, 0x82, 0x10, 0x83, 0x38, 0x9F, 0x10, 0x01, 0x38, 0x38, 0x93, 0x10, 0x01, 0x38, 0x38,
+0x8A, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x82, 0x10, 0x83, 0x38, 0x9A, 0x10, 0x01, 0x38, 0x38, 0x82,
+0x10, 0x01, 0x38, 0x38, 0x93, 0x10, 0x01, 0x38, 0x38, 0x8A, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x82,
+0x10, 0x83, 0x38, 0x86, 0x10, 0x01, 0x38, 0x38, 0x91, 0x10, 0x01, 0x38, 0x38, 0x82, 0x10, 0x01,
+0x38, 0x38, 0x93, 0x10, 0x01, 0x38, 0x38, 0x8A, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0x86, 0x38, 0x86,
+0x10, 0x01, 0x38, 0x38, 0x91, 0x10, 0x01, 0x38, 0x38, 0x82, 0x10, 0x01, 0x38, 0x38, 0x93, 0x10,
+0x01, 0x38, 0x38, 0x8A, 0x10, 0x00, 0x5B, 0x02, 0x5B, 0x10, 0x10, 0x84, 0x38, 0x86, 0x10, 0x01,
+0x38, 0x38, 0x91, 0x10, 0x01, 0x38, 0x38, 0x82, 0x10, 0x01, 0x38, 0x38, 0x8B, 0x10, 0x01, 0x38,
+0x38, 0x85, 0x10, 0x01, 0x38, 0x38, 0x89, 0x10, 0x01, 0x38, 0x5B, 0x02, 0x5B, 0x10, 0x10, 0x84,
+0x38, 0x86, 0x10, 0x01, 0x38, 0x38, 0x91, 0x10, 0x03, 0x38, 0x38, 0x10, 0x10, 0x82, 0x38, 0x8B,
+0x10, 0x01, 0x38, 0x38, 0x85, 0x10, 0x04, 0x38, 0x38, 0x10, 0x38, 0x38, 0x86, 0x10, 0x01, 0x38,
+0x5B, 0x02, 0x5B, 0x10, 0x10, 0x84, 0x38, 0x86, 0x10, 0x01, 0x38, 0x38, 0x91, 0x10, 0x06, 0x38,
+0x38, 0x10, 0x10, 0x38, 0x10, 0x38, 0x8B, 0x10, 0x01, 0x38, 0x38, 0x85, 0x10, 0x04, 0x38, 0x38,
+0x10, 0x38, 0x38, 0x86, 0x10, 0x01, 0x38, 0x5B, 0x02, 0x5B, 0x10, 0x10, 0x84, 0x38, 0x84, 0x10,
+0x83, 0x38, 0x91, 0x10, 0x06, 0x38, 0x38, 0x10, 0x10, 0x38, 0x10, 0x38, 0x8B, 0x10, 0x01, 0x38,
+0x38, 0x85, 0x10, 0x04, 0x38, 0x38, 0x10, 0x38, 0x38, 0x86, 0x10, 0x01, 0x38, 0x5B, 0x02, 0x5B,
+0x10, 0x10, 0x84, 0x38, 0x04, 0x10, 0x10, 0x38, 0x38, 0x10, 0x83, 0x38, 0x84, 0x10, 0x83, 0x38,
+0x86, 0x10, 0x83, 0x38, 0x03, 0x10, 0x10, 0x38, 0x10, 0x82, 0x38, 0x89, 0x10, 0x01, 0x38, 0x38,
+0x85, 0x10, 0x04, 0x38, 0x38, 0x10, 0x38, 0x38, 0x86, 0x10, 0x01, 0x38, 0x5B, 0x02, 0x5B, 0x10,
+0x10, 0x84, 0x38, 0x04, 0x10, 0x10, 0x38, 0x38, 0x10, 0x83, 0x38, 0x04, 0x10, 0x10, 0x38, 0x38,
+0x10, 0x84, 0x38, 0x85, 0x10, 0x83, 0x38, 0x03, 0x10, 0x10, 0x38, 0x10, 0x83, 0x38, 0x08, 0x10,
+0x10, 0x38, 0x38, 0x10, 0x10, 0x38, 0x38, 0x10, 0x82, 0x38, 0x84, 0x10, 0x04, 0x38, 0x38, 0x10,
+0x38, 0x38, 0x86, 0x10, 0x01, 0x38, 0x5B, 0x02, 0x5B, 0x10, 0x10, 0x84, 0x38, 0x01, 0x10, 0x10,
+0x87, 0x38, 0x03, 0x10, 0x38, 0x38, 0x10, 0x82, 0x38, 0x02, 0x10, 0x38, 0x38, 0x84, 0x10, 0x84,
+0x38, 0x1C, 0x10, 0x38, 0x10, 0x38, 0x38, 0x10, 0x38, 0x10, 0x10, 0x38, 0x38, 0x10, 0x10, 0x38,
+0x38, 0x10, 0x38, 0x10, 0x38, 0x10, 0x38, 0x38, 0x10, 0x10, 0x38, 0x38, 0x10, 0x38, 0x38, 0x86,
+0x10, 0x01, 0x38, 0x5B, 0x02, 0x5B, 0x10, 0x10, 0x84, 0x38, 0x01, 0x10, 0x10, 0x82, 0x38, 0x08,
+0x10, 0x38, 0x38, 0x10, 0x38, 0x10, 0x38, 0x38, 0x10, 0x82, 0x38, 0x02, 0x10, 0x10, 0x38, 0x83,
+0x10, 0x83, 0x38, 0x1E, 0x10, 0x38, 0x10, 0x38, 0x10, 0x38, 0x38, 0x10, 0x38, 0x10, 0x10, 0x38,
+0x38, 0x10, 0x10, 0x38, 0x38, 0x10, 0x38, 0x10, 0x38, 0x10, 0x38, 0x38, 0x10, 0x10, 0x38, 0x38,
+0x10, 0x38, 0x38, 0x86, 0x10, 0x01, 0x38, 0x5B, 0x09, 0x5B, 0x10, 0x10, 0x38, 0x38, 0x10, 0x10,
+0x38, 0x10, 0x10, 0x82, 0x38, 0x08, 0x10, 0x38, 0x38, 0x10, 0x38, 0x10, 0x38, 0x38, 0x10, 0x82,
+0x38, 0x02, 0x10, 0x10, 0x38, 0x83, 0x10, 0x17, 0x38, 0x10, 0x38, 0x38, 0x10, 0x38, 0x10, 0x38,
+0x10, 0x38, 0x38, 0x10, 0x38, 0x10, 0x10, 0x38, 0x38, 0x10, 0x10, 0x38, 0x38, 0x10, 0x38, 0x10,
+0x87, 0x38, 0x02, 0x10, 0x38, 0x38, 0x86, 0x10, 0x01, 0x38, 0x5B, 0x09, 0x5B, 0x10, 0x10, 0x38,
+0x38, 0x10, 0x10, 0x38, 0x10, 0x10, 0x82, 0x38, 0x03, 0x10, 0x38, 0x38, 0x10, 0x87, 0x38, 0x01,
+0x10, 0x10, 0x82, 0x38, 0x13, 0x10, 0x10, 0x38, 0x10, 0x38, 0x38, 0x10, 0x38, 0x10, 0x38, 0x10,
+0x38, 0x38, 0x10, 0x38, 0x10, 0x10, 0x38, 0x38, 0x10, 0x82, 0x38, 0x10, 0x10, 0x38, 0x10, 0x38,
+0x38, 0x10, 0x38, 0x38, 0x10, 0x10, 0x38, 0x10, 0x38, 0x38, 0x10, 0x38, 0x38, 0x83, 0x10, 0x01,
+0x38, 0x5B, 0x06, 0x5B, 0x10, 0x10, 0x38, 0x38, 0x10, 0x10, 0x85, 0x38, 0x0D, 0x10, 0x38, 0x38,
+0x10, 0x38, 0x38, 0x10, 0x38, 0x38, 0x10, 0x38, 0x38, 0x10, 0x10, 0x83, 0x38, 0x0C, 0x10, 0x38,
+0x10, 0x38, 0x38, 0x10, 0x38, 0x10, 0x38, 0x10, 0x38, 0x38, 0x10, 0x84, 0x38, 0x0D, 0x10, 0x38,
+0x10, 0x38, 0x10, 0x38, 0x10, 0x38, 0x38, 0x10, 0x38, 0x38, 0x10, 0x10, 0x83, 0x38, 0x02, 0x10,
+0x38, 0x38, 0x83, 0x10, 0x01, 0x38, 0x5B, 0x06, 0x5B, 0x10, 0x10, 0x38, 0x38, 0x10, 0x10, 0x85,
+0x38, 0x83, 0x10, 0x04, 0x38, 0x38, 0x10, 0x38, 0x38, 0x84, 0x10, 0x10, 0x38, 0x38, 0x10, 0x38,
+0x10, 0x38, 0x10, 0x38, 0x38, 0x10, 0x38, 0x10, 0x38, 0x10, 0x38, 0x38, 0x10, 0x84, 0x38, 0x08,
+0x10, 0x38, 0x10, 0x38, 0x10, 0x38, 0x10, 0x38, 0x38, 0x84, 0x10, 0x02, 0x38, 0x38, 0x10, 0x83,
+0x38, 0x83, 0x10, 0x01, 0x38, 0x5B, 0x06, 0x5B, 0x10, 0x10, 0x38, 0x38, 0x10, 0x10, 0x85, 0x38,
+0x83, 0x10, 0x04, 0x38, 0x38, 0x10, 0x38, 0x38, 0x84, 0x10, 0x18, 0x38, 0x38, 0x10, 0x38, 0x10,
+0x38, 0x10, 0x38, 0x38, 0x10, 0x38, 0x10, 0x38, 0x10, 0x38, 0x38, 0x10, 0x38, 0x38, 0x10, 0x10,
+0x38, 0x10, 0x38, 0x10, 0x82, 0x38, 0x02, 0x10, 0x38, 0x38, 0x84, 0x10, 0x06, 0x38, 0x38, 0x10,
+0x38, 0x38, 0x10, 0x38, 0x83, 0x10, 0x01, 0x38, 0x5B, 0x06, 0x5B, 0x10, 0x10, 0x38, 0x38, 0x10,
+0x10, 0x83, 0x38, 0x85, 0x10, 0x04, 0x38, 0x38, 0x10, 0x38, 0x38, 0x84, 0x10, 0x0F, 0x38, 0x38,
+0x10, 0x38, 0x10, 0x38, 0x10, 0x38, 0x38, 0x10, 0x38, 0x10, 0x38, 0x10, 0x38, 0x38, 0x84, 0x10,
+0x09, 0x38, 0x10, 0x38, 0x10, 0x38, 0x38, 0x10, 0x10, 0x38, 0x38, 0x84, 0x10, 0x0C, 0x38, 0x38,
+0x10, 0x38, 0x38, 0x10, 0x38, 0x10, 0x38, 0x38, 0x10, 0x38, 0x5B, 0x06, 0x5B, 0x10, 0x10, 0x38,
+0x38, 0x10, 0x10, 0x83, 0x38, 0x85, 0x10, 0x04, 0x38, 0x38, 0x10, 0x38, 0x38, 0x84, 0x10, 0x02,
+0x38, 0x38, 0x10, 0x82, 0x38, 0x03, 0x10, 0x38, 0x38, 0x10, 0x82, 0x38, 0x02, 0x10, 0x38, 0x38,
+0x84, 0x10, 0x09, 0x38, 0x10, 0x38, 0x10, 0x38, 0x38, 0x10, 0x10, 0x38, 0x38, 0x84, 0x10, 0x0C,
+0x38, 0x38, 0x10, 0x38, 0x38, 0x10, 0x38, 0x10, 0x38, 0x38, 0x10, 0x38, 0x5B, 0x00, 0x5B, 0x85,
+0x10, 0x83, 0x38, 0x88, 0x10, 0x01, 0x38, 0x38, 0x84, 0x10, 0x0C, 0x38, 0x38, 0x10, 0x10, 0x38,
+0x38, 0x10, 0x38, 0x38, 0x10, 0x10, 0x38, 0x38, 0x87, 0x10, 0x02, 0x38, 0x10, 0x38, 0x84, 0x10,
+0x01, 0x38, 0x38, 0x84, 0x10, 0x0C, 0x38, 0x38, 0x10, 0x38, 0x38, 0x10, 0x38, 0x10, 0x38, 0x38,
+0x10, 0x38, 0x5B, 0x00, 0x5B, 0x85, 0x10, 0x83, 0x38, 0x88, 0x10, 0x01, 0x38, 0x38, 0x84, 0x10,
+0x0C, 0x38, 0x38, 0x10, 0x10, 0x38, 0x38, 0x10, 0x38, 0x38, 0x10, 0x10, 0x38, 0x38, 0x87, 0x10,
+0x02, 0x38, 0x10, 0x38, 0x84, 0x10, 0x01, 0x38, 0x38, 0x84, 0x10, 0x0C, 0x38, 0x38, 0x10, 0x38,
+0x38, 0x10, 0x38, 0x10, 0x38, 0x38, 0x10, 0x38, 0x5B, 0x00, 0x5B, 0x85, 0x10, 0x83, 0x38, 0x88,
+0x10, 0x01, 0x38, 0x38, 0x84, 0x10, 0x0C, 0x38, 0x38, 0x10, 0x10, 0x38, 0x38, 0x10, 0x38, 0x38,
+0x10, 0x10, 0x38, 0x38, 0x87, 0x10, 0x02, 0x38, 0x10, 0x38, 0x84, 0x10, 0x01, 0x38, 0x38, 0x84,
+0x10, 0x01, 0x38, 0x38, 0x83, 0x10, 0x83, 0x38, 0x02, 0x10, 0x38, 0x5B, 0x00, 0x5B, 0x87, 0x10,
+0x01, 0x38, 0x38, 0x88, 0x10, 0x01, 0x38, 0x38, 0x84, 0x10, 0x0C, 0x38, 0x38, 0x10, 0x10, 0x38,
+0x38, 0x10, 0x38, 0x38, 0x10, 0x10, 0x38, 0x38, 0x87, 0x10, 0x02, 0x38, 0x10, 0x38, 0x8B, 0x10,
+0x01, 0x38, 0x38, 0x84, 0x10, 0x82, 0x38, 0x02, 0x10, 0x38, 0x5B, 0x00, 0x5B, 0x87, 0x10, 0x01,
+0x38, 0x38, 0x88, 0x10, 0x01, 0x38, 0x38, 0x84, 0x10, 0x0C, 0x38, 0x38, 0x10, 0x10, 0x38, 0x38,
+0x10, 0x38, 0x38, 0x10, 0x10, 0x38, 0x38, 0x87, 0x10, 0x82, 0x38, 0x8B, 0x10, 0x01, 0x38, 0x38,
+0x84, 0x10, 0x82, 0x38, 0x02, 0x10, 0x38, 0x5B, 0x00, 0x5B, 0x92, 0x10, 0x01, 0x38, 0x38, 0x84,
+0x10, 0x0C, 0x38, 0x38, 0x10, 0x10, 0x38, 0x38, 0x10, 0x38, 0x38, 0x10, 0x10, 0x38, 0x38, 0x88,
+0x10, 0x01, 0x38, 0x38, 0x8B, 0x10, 0x01, 0x38, 0x38, 0x84, 0x10, 0x82, 0x38, 0x02, 0x10, 0x38,
+0x5B, 0x00, 0x5B, 0x92, 0x10, 0x01, 0x38, 0x38, 0x84, 0x10, 0x0C, 0x38, 0x38, 0x10, 0x10, 0x38,
+0x38, 0x10, 0x38, 0x38, 0x10, 0x10, 0x38, 0x38, 0x88, 0x10, 0x01, 0x38, 0x38, 0x8B, 0x10, 0x01,
+0x38, 0x38, 0x84, 0x10, 0x84, 0x38, 0x00, 0x5B, 0x00, 0x5B, 0x92, 0x10, 0x01, 0x38, 0x38, 0x84,
+0x10, 0x0C, 0x38, 0x38, 0x10, 0x10, 0x38, 0x38, 0x10, 0x38, 0x38, 0x10, 0x10, 0x38, 0x38, 0x96,
+0x10, 0x01, 0x38, 0x38, 0x84, 0x10, 0x05, 0x38, 0x38, 0x10, 0x38, 0x38, 0x5B, 0x00, 0x5B, 0x92,
+0x10, 0x01, 0x38, 0x38, 0x84, 0x10, 0x0C, 0x38, 0x38, 0x10, 0x10, 0x38, 0x38, 0x10, 0x38, 0x38,
+0x10, 0x10, 0x38, 0x38, 0x9D, 0x10, 0x05, 0x38, 0x38, 0x10, 0x38, 0x38, 0x5B, 0x00, 0x5B, 0x92,
+0x10, 0x01, 0x38, 0x38, 0x84, 0x10, 0x0C, 0x38, 0x38, 0x10, 0x10, 0x38, 0x38, 0x10, 0x38, 0x38,
+0x10, 0x10, 0x38, 0x38, 0x9D, 0x10, 0x05, 0x38, 0x38, 0x10, 0x38, 0x38, 0x5B, 0x00, 0x5B, 0x92,
+0x10, 0x01, 0x38, 0x38, 0x84, 0x10, 0x0C, 0x38, 0x38, 0x10, 0x10, 0x38, 0x38, 0x10, 0x38, 0x38,
+0x10, 0x10, 0x38, 0x38, 0x9D, 0x10, 0x05, 0x38, 0x38, 0x10, 0x38, 0x38, 0x5B, 0x00, 0x5B, 0x92,
+0x10, 0x01, 0x38, 0x38, 0x8B, 0x10, 0x05, 0x38, 0x38, 0x10, 0x10, 0x38, 0x38, 0x9D, 0x10, 0x05,
+0x38, 0x38, 0x10, 0x38, 0x38, 0x5B, 0x00, 0x5B, 0xA0, 0x10, 0x05, 0x38, 0x38, 0x10, 0x10, 0x38,
+0x38, 0x9D, 0x10, 0x01, 0x38, 0x38, 0x82, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0xA0, 0x10, 0x01, 0x38,
+0x38, 0xA6, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00,
+0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0xC9,
+0x10, 0x00, 0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B, 0x00, 0x5B, 0xC9, 0x10, 0x00, 0x5B, 0xCB,
+0x5B};
+
+// Raw size: 21280 bytes, RLE size(with line offsets): 6411 bytes
 
-const ImageDesc waveforms[] = {
-{76, 56, 8, {.img = waveforms_0_data}, PALETTE_884, -1},
-{76, 56, 8, {.img = waveforms_1_data}, PALETTE_884, -1},
-{76, 56, 8, {.img = waveforms_2_data}, PALETTE_884, -1},
-{76, 56, 8, {.img = waveforms_3_data}, PALETTE_884, -1}};
+const RleImageDesc waveforms[] = {
+{76, 56, waveforms_0_line, waveforms_0_data, PALETTE_884, -1},
+{76, 56, waveforms_1_line, waveforms_1_data, PALETTE_884, -1},
+{76, 56, waveforms_2_line, waveforms_2_data, PALETTE_884, -1},
+{76, 56, waveforms_3_line, waveforms_3_data, PALETTE_884, -1},
+{76, 56, waveforms_4_line, waveforms_4_data, PALETTE_884, -1}};
@@ -0,0 +1,266 @@
+//******************************************************************************
+//  @file Keypad.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details Application: Numeric Keypad Class, implementation
+//
+//  @copyright Copyright (c) 2016, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "Keypad.h"
+
+#include <cstring>
+
+#include "NumFormatter.h"
+
+// *****************************************************************************
+// ***   Keys layout   *********************************************************
+// *****************************************************************************
+const char* const Keypad::KEYS[ROWS * COLS] =
+{
+  "7", "8", "9", "Hz",  "<",
+  "4", "5", "6", "kHz", "C",
+  "1", "2", "3", "MHz", "mV",
+  ".", "0", "%", "s",   "Esc",
+  "Mode", "Shape", "Dir", "Par", "Cyc",
+  "Trig", "Err", "ns", "deg", ""
+};
+
+// *****************************************************************************
+// ***   Unit and action keys   ************************************************
+// *****************************************************************************
+const Keypad::UnitKeyType Keypad::UNIT_KEYS[] =
+{
+  {"Hz",    UNIT_HZ,      true},
+  {"kHz",   UNIT_KHZ,     true},
+  {"MHz",   UNIT_MHZ,     true},
+  {"%",     UNIT_PERCENT, true},
+  {"mV",    UNIT_MV,      true},
+  {"s",     UNIT_S,       true},
+  {"Cyc",   UNIT_CYCLES,  true},
+  {"Err",   UNIT_ERR,     true},
+  {"ns",    UNIT_NS,      true},
+  {"deg",   UNIT_DEG,     true},
+  {"Mode",  ACTION_MODE,  false},
+  {"Shape", ACTION_SHAPE, false},
+  {"Dir",   ACTION_DIR,   false},
+  {"Trig",  ACTION_TRIG,  false}
+};
+
+// *****************************************************************************
+// ***   Target names   ********************************************************
+// *****************************************************************************
+const char* const Keypad::TARGET_NAMES[TARGET_CNT] = {"", "F2", "Dev", "Pat", "Hop"};
+
+// *****************************************************************************
+// ***   Setup   ***************************************************************
+// *****************************************************************************
+void Keypad::Setup(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  // Line for entry string
+  int32_t entry_h = 24;
+  // Button size
+  int32_t btn_w = w / COLS;
+  int32_t btn_h = (h - entry_h) / ROWS;
+
+  bg.SetParams(x, y, w, h, COLOR_BLACK, true);
+  entry_str.SetParams(entry_str_data, x + 4, y + (entry_h - 12) / 2, COLOR_WHITE, Font_8x12::GetInstance());
+  for(uint32_t i = 0U; i < NumberOf(btn); i++)
+  {
+    btn[i].SetParams(KEYS[i], x + btn_w * (i % COLS), y + entry_h + btn_h * (i / COLS), btn_w, btn_h, true);
+    btn[i].SetCallback(AppTask::GetCurrent(), reinterpret_cast<CallbackPtr>(&ButtonCallback), this);
+  }
+}
+
+// *****************************************************************************
+// ***   Open   ****************************************************************
+// *****************************************************************************
+void Keypad::Open(const char* title, CallbackPtr func, void* param)
+{
+  // Save title and callback
+  title_str = title;
+  callback = func;
+  callback_param = param;
+  // Clear entry
+  entry_len = 0U;
+  entry[0U] = '\0';
+  unit = UNIT_NONE;
+  value_milli = 0U;
+  target = TARGET_MAIN;
+  UpdateEntry();
+  // Show keypad above everything else
+  bg.Show(KEYPAD_Z);
+  entry_str.Show(KEYPAD_Z + 1U);
+  for(uint32_t i = 0U; i < NumberOf(btn); i++)
+  {
+    // Empty places in layout
+    if(KEYS[i][0U] != '\0') btn[i].Show(KEYPAD_Z + 1U);
+  }
+  is_open = true;
+}
+
+// *****************************************************************************
+// ***   Close   ***************************************************************
+// *****************************************************************************
+void Keypad::Close()
+{
+  for(uint32_t i = 0U; i < NumberOf(btn); i++)
+  {
+    btn[i].Hide();
+  }
+  entry_str.Hide();
+  bg.Hide();
+  is_open = false;
+}
+
+// *****************************************************************************
+// ***   ButtonCallback   ********************************************************
+// *****************************************************************************
+Result Keypad::ButtonCallback(Keypad* kp, void* ptr)
+{
+  // Find which button is touched
+  for(uint32_t i = 0U; i < NumberOf(kp->btn); i++)
+  {
+    if(ptr == &kp->btn[i])
+    {
+      kp->ProcessKey(KEYS[i]);
+      break;
+    }
+  }
+
+  // Always run
+  return Result::RESULT_OK;
+}
+
+// *****************************************************************************
+// ***   ProcessKey   **********************************************************
+// *****************************************************************************
+void Keypad::ProcessKey(const char* key)
+{
+  // Ignore keys if keypad isn't open
+  if(is_open)
+  {
+    // Digit or point
+    if((key[1U] == '\0') && (((key[0U] >= '0') && (key[0U] <= '9')) || (key[0U] == '.')))
+    {
+      bool allowed = (entry_len < MAX_ENTRY_LEN);
+      // Only one point and limited count of digits after it
+      for(uint32_t i = 0U; i < entry_len; i++)
+      {
+        if(entry[i] == '.')
+        {
+          allowed = allowed && (key[0U] != '.') && (entry_len - i <= MAX_DECIMALS);
+        }
+      }
+      if(allowed)
+      {
+        entry[entry_len++] = key[0U];
+        entry[entry_len] = '\0';
+        UpdateEntry();
+      }
+    }
+    else if(key[0U] == '<')
+    {
+      if(entry_len > 0U) entry[--entry_len] = '\0';
+      UpdateEntry();
+    }
+    else if((key[0U] == 'C') && (key[1U] == '\0'))
+    {
+      entry_len = 0U;
+      entry[0U] = '\0';
+      UpdateEntry();
+    }
+    else if(strcmp(key, "Esc") == 0)
+    {
+      Finish(UNIT_NONE);
+    }
+    else if(strcmp(key, "Par") == 0)
+    {
+      target = (TargetType)(target + 1U);
+      if(target >= TARGET_CNT) target = TARGET_MAIN;
+      UpdateEntry();
+    }
+    else // Units and actions
+    {
+      for(uint32_t i = 0U; i < NumberOf(UNIT_KEYS); i++)
+      {
+        if(strcmp(key, UNIT_KEYS[i].key) == 0)
+        {
+          // Units only if something is entered
+          if((UNIT_KEYS[i].need_value == false) || (entry_len > 0U))
+          {
+            Finish(UNIT_KEYS[i].unit);
+          }
+          break;
+        }
+      }
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Finish   ****************************************************************
+// *****************************************************************************
+void Keypad::Finish(UnitType u)
+{
+  // Convert entry to fixed point value with three digits after point
+  uint64_t value = 0U;
+  int32_t decimals = -1;
+  for(uint32_t i = 0U; i < entry_len; i++)
+  {
+    if(entry[i] == '.')
+    {
+      decimals = 0;
+    }
+    else
+    {
+      value = value * 10U + (entry[i] - '0');
+      if(decimals >= 0) decimals++;
+    }
+  }
+  if(decimals < 0) decimals = 0;
+  for(; decimals < (int32_t)MAX_DECIMALS; decimals++)
+  {
+    value *= 10U;
+  }
+
+  // Store result
+  unit = u;
+  value_milli = value;
+
+  // Close keypad and notify owner
+  Close();
+  if(callback != nullptr)
+  {
+    callback(callback_param, this);
+  }
+}
+
+// *****************************************************************************
+// ***   UpdateEntry   *********************************************************
+// *****************************************************************************
+void Keypad::UpdateEntry()
+{
+  const char* end = entry_str_data + NumberOf(entry_str_data) - 1U;
+  char* ptr = NumFormatter::Str(entry_str_data, end, title_str);
+  if(target != TARGET_MAIN)
+  {
+    ptr = NumFormatter::Str(ptr, end, TARGET_NAMES[target]);
+    ptr = NumFormatter::Str(ptr, end, " ");
+  }
+  ptr = NumFormatter::Str(ptr, end, entry);
+  ptr = NumFormatter::Str(ptr, end, "_");
+  *ptr = '\0';
+  entry_str.SetString(entry_str_data);
+}
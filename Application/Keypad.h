@@ -0,0 +1,191 @@
+//******************************************************************************
+//  @file Keypad.h
+//  @author Nicolai Shlapunov
+//
+//  @details Application: Numeric Keypad Class, header
+//
+//  @copyright Copyright (c) 2016, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef Keypad_h
+#define Keypad_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+#include "AppTask.h"
+#include "DisplayDrv.h"
+#include "UiEngine.h"
+
+// *****************************************************************************
+// ***   Keypad Class   ********************************************************
+// *****************************************************************************
+//
+// Pop-up numeric keypad. Value is entered with up to three digits after point
+// and confirmed by pressing unit button. After unit or cancel button is pressed
+// keypad is closed and callback is called with pointer to keypad as parameter.
+// Callback should use GetUnit() and GetValueMilli() to get entered value.
+// "Par" key cycles target of the entered value through secondary parameters of
+// the mode: F2 is stop frequency of sweep or modulation rate, Dev is
+// modulation depth or frequency spread, Pat is pattern generator: frequency is word rate, cycles
+// is burst repeats and mode key changes pattern mode, Hop is hop list:
+// frequency appends hop, percent sets duty of the last hop, cycles is periods
+// per hop and zero frequency clears list. Action keys close keypad without
+// value, callback gets action from GetUnit().
+//
+class Keypad
+{
+  public:
+    // *************************************************************************
+    // ***   Enum with all units   *********************************************
+    // *************************************************************************
+    typedef enum : uint8_t
+    {
+      UNIT_NONE = 0U, // Entry cancelled
+      UNIT_HZ,
+      UNIT_KHZ,
+      UNIT_MHZ,
+      UNIT_PERCENT,
+      UNIT_MV,
+      UNIT_S,
+      UNIT_CYCLES,
+      UNIT_ERR,
+      UNIT_NS,
+      UNIT_DEG,
+      // Actions, entered value is ignored
+      ACTION_MODE,
+      ACTION_SHAPE,
+      ACTION_DIR,
+      ACTION_TRIG,
+      UNIT_CNT
+    } UnitType;
+
+    // *************************************************************************
+    // ***   Enum with entry targets   *****************************************
+    // *************************************************************************
+    typedef enum : uint8_t
+    {
+      TARGET_MAIN = 0U, // Frequency, duty or amplitude
+      TARGET_F2,        // Sweep stop frequency or modulation rate
+      TARGET_DEV,       // Modulation depth or frequency spread
+      TARGET_PAT,       // Pattern generator
+      TARGET_HOP,       // Frequency hopping list
+      TARGET_CNT
+    } TargetType;
+
+    // *************************************************************************
+    // ***   Setup   ***********************************************************
+    // *************************************************************************
+    void Setup(int32_t x, int32_t y, int32_t w, int32_t h);
+
+    // *************************************************************************
+    // ***   Open   ************************************************************
+    // *************************************************************************
+    void Open(const char* title, CallbackPtr func, void* param);
+
+    // *************************************************************************
+    // ***   Close   ***********************************************************
+    // *************************************************************************
+    void Close();
+
+    // *************************************************************************
+    // ***   IsOpen   **********************************************************
+    // *************************************************************************
+    bool IsOpen() {return is_open;}
+
+    // *************************************************************************
+    // ***   GetUnit   *********************************************************
+    // *************************************************************************
+    UnitType GetUnit() {return unit;}
+
+    // *************************************************************************
+    // ***   GetValueMilli   ***************************************************
+    // *************************************************************************
+    // Entered value multiplied by 1000
+    uint64_t GetValueMilli() {return value_milli;}
+
+    // *************************************************************************
+    // ***   GetTarget   *******************************************************
+    // *************************************************************************
+    TargetType GetTarget() {return target;}
+
+  private:
+    // Keys layout
+    static const uint32_t ROWS = 6U;
+    static const uint32_t COLS = 5U;
+    static const char* const KEYS[ROWS * COLS];
+
+    // Structure for unit and action keys
+    typedef struct
+    {
+      const char* key;  // Key text
+      UnitType unit;    // Unit or action reported to owner
+      bool need_value;  // Key works only if something is entered
+    } UnitKeyType;
+    // Unit and action keys
+    static const UnitKeyType UNIT_KEYS[];
+    // Entry target names
+    static const char* const TARGET_NAMES[TARGET_CNT];
+    // Maximum count of entered characters
+    static const uint32_t MAX_ENTRY_LEN = 10U;
+    // Maximum digits after point
+    static const uint32_t MAX_DECIMALS = 3U;
+    // Z position for keypad elements
+    static const uint32_t KEYPAD_Z = 10U;
+
+    // Background
+    Box bg;
+    // Buttons
+    UiButton btn[ROWS * COLS];
+    // Entry string
+    String entry_str;
+    char entry_str_data[32] = {0};
+    // Title
+    const char* title_str = "";
+    // Entered characters
+    char entry[MAX_ENTRY_LEN + 1U] = {0};
+    uint32_t entry_len = 0U;
+
+    // Result
+    UnitType unit = UNIT_NONE;
+    uint64_t value_milli = 0U;
+    TargetType target = TARGET_MAIN;
+
+    // Owner callback
+    CallbackPtr callback = nullptr;
+    void* callback_param = nullptr;
+
+    // Keypad state
+    bool is_open = false;
+
+    // *************************************************************************
+    // ***   ButtonCallback   **************************************************
+    // *************************************************************************
+    static Result ButtonCallback(Keypad* kp, void* ptr);
+
+    // *************************************************************************
+    // ***   ProcessKey   ******************************************************
+    // *************************************************************************
+    void ProcessKey(const char* key);
+
+    // *************************************************************************
+    // ***   Finish   **********************************************************
+    // *************************************************************************
+    void Finish(UnitType u);
+
+    // *************************************************************************
+    // ***   UpdateEntry   *****************************************************
+    // *************************************************************************
+    void UpdateEntry();
+};
+
+#endif
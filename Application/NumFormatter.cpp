@@ -0,0 +1,186 @@
+//******************************************************************************
+//  @file NumFormatter.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details Application: Number Formatter Class, implementation
+//
+//  @copyright Copyright (c) 2016, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "NumFormatter.h"
+
+// *****************************************************************************
+// ***   Frequency   ***********************************************************
+// *****************************************************************************
+uint32_t NumFormatter::Frequency(char* buf, uint32_t size, const char* label, uint32_t freq)
+{
+  uint32_t result = 0U;
+
+  if((buf != nullptr) && (size > 0U))
+  {
+    // Leave space for terminating zero
+    const char* end = buf + size - 1U;
+    char* ptr = Str(buf, end, label);
+
+    // Select unit to keep value exact and integer part less than 1000
+    if(freq >= 1000000U)
+    {
+      ptr = Fixed(ptr, end, freq, 6U, VALUE_WIDTH);
+      ptr = Str(ptr, end, " MHz");
+    }
+    else if(freq >= 1000U)
+    {
+      ptr = Fixed(ptr, end, freq, 3U, VALUE_WIDTH);
+      ptr = Str(ptr, end, " kHz");
+    }
+    else
+    {
+      ptr = Fixed(ptr, end, freq, 0U, VALUE_WIDTH);
+      ptr = Str(ptr, end, " Hz ");
+    }
+
+    *ptr = '\0';
+    result = ptr - buf;
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Value   ***************************************************************
+// *****************************************************************************
+uint32_t NumFormatter::Value(char* buf, uint32_t size, const char* label, int32_t value, uint8_t decimals, const char* unit)
+{
+  uint32_t result = 0U;
+
+  if((buf != nullptr) && (size > 0U))
+  {
+    // Leave space for terminating zero
+    const char* end = buf + size - 1U;
+    char* ptr = Str(buf, end, label);
+    ptr = Fixed(ptr, end, value, decimals, VALUE_WIDTH);
+    ptr = Str(ptr, end, " ");
+    ptr = Str(ptr, end, unit);
+
+    *ptr = '\0';
+    result = ptr - buf;
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Time   ****************************************************************
+// *****************************************************************************
+char* NumFormatter::Time(char* buf, const char* end, uint32_t time_ms)
+{
+  if(time_ms < 1000U)
+  {
+    buf = Fixed(buf, end, time_ms, 0U, 0U);
+    buf = Str(buf, end, "ms");
+  }
+  else
+  {
+    buf = Fixed(buf, end, time_ms / 100U, 1U, 0U);
+    buf = Str(buf, end, "s");
+  }
+  return buf;
+}
+
+// *****************************************************************************
+// ***   TimePs   **************************************************************
+// *****************************************************************************
+char* NumFormatter::TimePs(char* buf, const char* end, uint64_t time_ps)
+{
+  static const char* const UNITS[] = {"ns", "us", "ms", "s"};
+  uint64_t unit = 1000U;
+  uint32_t idx = 0U;
+
+  // Select unit to keep integer part less than 1000
+  while((idx + 1U < sizeof(UNITS) / sizeof(UNITS[0U])) && (time_ps >= unit * 1000U))
+  {
+    unit *= 1000U;
+    idx++;
+  }
+  // Four significant digits
+  uint64_t int_part = time_ps / unit;
+  uint8_t decimals = (int_part < 10U) ? 3U : ((int_part < 100U) ? 2U : 1U);
+  uint64_t scale = (decimals == 3U) ? 1000U : ((decimals == 2U) ? 100U : 10U);
+  buf = Fixed(buf, end, (int32_t)((time_ps * scale) / unit), decimals, 0U);
+  buf = Str(buf, end, UNITS[idx]);
+
+  return buf;
+}
+
+// *****************************************************************************
+// ***   Fixed   ***************************************************************
+// *****************************************************************************
+char* NumFormatter::Fixed(char* buf, const char* end, int32_t value, uint8_t decimals, uint8_t width)
+{
+  // 32-bit value has 10 digits, so more decimals only add leading zeros.
+  // Enough for sign, point and 11 digits of maximum decimals.
+  char tmp[MAX_DECIMALS + 3U];
+  uint32_t cnt = 0U;
+  if(decimals > MAX_DECIMALS) decimals = MAX_DECIMALS;
+  // Negative value can't be simply negated in case of INT32_MIN
+  uint32_t val = (value < 0) ? (0U - (uint32_t)value) : (uint32_t)value;
+
+  // Fill digits in reverse order
+  do
+  {
+    if((decimals != 0U) && (cnt == decimals))
+    {
+      tmp[cnt++] = '.';
+    }
+    tmp[cnt++] = '0' + (val % 10U);
+    val /= 10U;
+  }
+  // Continue until all digits and at least one digit before point are written
+  while((val != 0U) || (cnt <= decimals));
+  // Add sign
+  if(value < 0)
+  {
+    tmp[cnt++] = '-';
+  }
+
+  // Right alignment
+  while((width > cnt) && (buf < end))
+  {
+    *buf++ = ' ';
+    width--;
+  }
+  // Copy digits in correct order
+  while((cnt > 0U) && (buf < end))
+  {
+    *buf++ = tmp[--cnt];
+  }
+
+  return buf;
+}
+
+// *****************************************************************************
+// ***   Str   *****************************************************************
+// *****************************************************************************
+char* NumFormatter::Str(char* buf, const char* end, const char* str)
+{
+  if(str != nullptr)
+  {
+    while((*str != '\0') && (buf < end))
+    {
+      *buf++ = *str++;
+    }
+  }
+
+  return buf;
+}
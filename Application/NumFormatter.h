@@ -0,0 +1,88 @@
+//******************************************************************************
+//  @file NumFormatter.h
+//  @author Nicolai Shlapunov
+//
+//  @details Application: Number Formatter Class, header
+//
+//  @copyright Copyright (c) 2016, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef NumFormatter_h
+#define NumFormatter_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include <cstdint>
+
+// *****************************************************************************
+// ***   NumFormatter Class   **************************************************
+// *****************************************************************************
+//
+// Formats numbers with engineering units directly into caller provided buffer.
+// It doesn't use varargs, heap or locale, so it is much cheaper than printf-like
+// String::SetString() in both flash, stack and CPU cycles.
+//
+// All functions always terminate string with zero and return count of written
+// characters(without terminating zero).
+//
+class NumFormatter
+{
+  public:
+    // *************************************************************************
+    // ***   Frequency   *******************************************************
+    // *************************************************************************
+    // Output example: "Freq:      999 Hz ", "Freq:   12.345 kHz",
+    //                 "Freq: 1.234567 MHz"
+    static uint32_t Frequency(char* buf, uint32_t size, const char* label, uint32_t freq);
+
+    // *************************************************************************
+    // ***   Value   ***********************************************************
+    // *************************************************************************
+    // Value is fixed-point number with decimals digits after the point. Output
+    // example for Value(buf, size, "Duty: ", 5025, 2, "%"): "Duty:    50.25 %"
+    static uint32_t Value(char* buf, uint32_t size, const char* label, int32_t value, uint8_t decimals, const char* unit);
+
+    // *************************************************************************
+    // ***   Time   ************************************************************
+    // *************************************************************************
+    // Write time without padding. Output example: "500ms", "1.5s", "100.0s"
+    static char* Time(char* buf, const char* end, uint32_t time_ms);
+
+    // *************************************************************************
+    // ***   TimePs   **********************************************************
+    // *************************************************************************
+    // Write time in picoseconds with four significant digits without padding.
+    // Output example: "11.90ns", "1.250us", "500.0us"
+    static char* TimePs(char* buf, const char* end, uint64_t time_ps);
+
+    // *************************************************************************
+    // ***   Fixed   ***********************************************************
+    // *************************************************************************
+    // Write fixed-point number right aligned in the field of width characters.
+    // Decimals are limited to MAX_DECIMALS.
+    static char* Fixed(char* buf, const char* end, int32_t value, uint8_t decimals, uint8_t width);
+
+    // *************************************************************************
+    // ***   Str   *************************************************************
+    // *************************************************************************
+    // Copy string, but not more than end pointer allows
+    static char* Str(char* buf, const char* end, const char* str);
+
+    // Maximum digits after the point
+    static const uint8_t MAX_DECIMALS = 10U;
+
+  private:
+    // Width of the numeric field
+    static const uint8_t VALUE_WIDTH = 8U;
+};
+
+#endif
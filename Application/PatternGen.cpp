@@ -0,0 +1,452 @@
+//******************************************************************************
+//  @file PatternGen.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details Application: Parallel Pattern Generator Class, implementation
+//
+//  @copyright Copyright (c) 2016, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "PatternGen.h"
+
+#include <cstring>
+
+#include "fatfs.h"
+
+// *****************************************************************************
+// ***   Get Instance   ********************************************************
+// *****************************************************************************
+PatternGen& PatternGen::GetInstance(void)
+{
+   static PatternGen pattern_gen;
+   return pattern_gen;
+}
+
+// *****************************************************************************
+// ***   PatternGen Loop   *****************************************************
+// *****************************************************************************
+Result PatternGen::Loop()
+{
+  task_handle = xTaskGetCurrentTaskHandle();
+
+  while(1)
+  {
+    // DMA interrupt gives notification when half of stream buffer is output,
+    // USB interrupt when pattern is received
+    (void) ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    file_mutex.Lock();
+    // Pattern received over USB replaces buffer content
+    TakeUsbPattern();
+    // Refill stream buffer from SD card
+    Process();
+    file_mutex.Release();
+  }
+
+  // Always run
+  return Result::RESULT_OK;
+}
+
+// *****************************************************************************
+// ***   LoadFile   ************************************************************
+// *****************************************************************************
+Result PatternGen::LoadFile(const char* name)
+{
+  // Buffer will be overwritten
+  Stop();
+
+  file_mutex.Lock();
+  len = 0U;
+  Result result = Mount();
+
+  if(result.IsGood())
+  {
+    UINT br = 0U;
+    if((f_open(&SDFile, name, FA_READ) == FR_OK))
+    {
+      if(f_read(&SDFile, buf, sizeof(buf), &br) == FR_OK)
+      {
+        len = br;
+      }
+      (void) f_close(&SDFile);
+    }
+    // Missing, unreadable or empty file
+    if(len == 0U)
+    {
+      result = Result::ERR_BAD_PARAMETER;
+    }
+  }
+  file_mutex.Release();
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   UsbReceive   **********************************************************
+// *****************************************************************************
+void PatternGen::UsbReceive(const uint8_t* data, uint32_t size)
+{
+  for(uint32_t i = 0U; i < size; i++)
+  {
+    // Length header
+    if(usb_hdr_cnt < 4U)
+    {
+      // New pattern. If previous one isn't taken by pattern task yet, staging
+      // buffer is in use and this pattern is dropped.
+      if(usb_hdr_cnt == 0U)
+      {
+        usb_skip = usb_ready;
+        usb_len = 0U;
+        usb_pos = 0U;
+      }
+      usb_len |= (uint32_t)data[i] << (8U * usb_hdr_cnt);
+      usb_hdr_cnt++;
+    }
+    else
+    {
+      // Data above buffer size is dropped
+      if(!usb_skip && (usb_pos < sizeof(usb_buf))) usb_buf[usb_pos] = data[i];
+      usb_pos++;
+    }
+    // Pattern is complete, next byte is header of the next pattern
+    if((usb_hdr_cnt == 4U) && (usb_pos == usb_len))
+    {
+      if(!usb_skip)
+      {
+        usb_ready_len = (usb_len < sizeof(usb_buf)) ? usb_len : sizeof(usb_buf);
+        usb_ready = true;
+        NotifyFromIsr();
+      }
+      usb_hdr_cnt = 0U;
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Start   ***************************************************************
+// *****************************************************************************
+Result PatternGen::Start(ModeType m, uint32_t r, uint32_t repeat, const char* name)
+{
+  Result result;
+
+  Stop();
+
+  // Pattern task can't replace buffer while output is set up
+  file_mutex.Lock();
+
+  // Limit word rate
+  uint32_t max_rate = (m == MODE_STREAM) ? MAX_STREAM_RATE : MAX_RATE;
+  if(r > max_rate) r = max_rate;
+
+  if((r == 0U) || (m >= MODE_CNT) || ((m != MODE_STREAM) && (len == 0U)))
+  {
+    result = Result::ERR_BAD_PARAMETER;
+  }
+  else if(m == MODE_STREAM)
+  {
+    result = Mount();
+    // Empty file would never fill the buffer
+    if(result.IsGood() && ((f_open(&SDFile, name, FA_READ) != FR_OK) || (f_size(&SDFile) == 0U)))
+    {
+      (void) f_close(&SDFile);
+      result = Result::ERR_BAD_PARAMETER;
+    }
+    if(result.IsGood())
+    {
+      file_open = true;
+      // Loaded pattern is overwritten, so it should be loaded again for loop
+      // and burst modes
+      len = 0U;
+      // Fill whole buffer before start
+      ReadFile(buf, sizeof(buf));
+      empty[0U] = false;
+      empty[1U] = false;
+      underruns = 0U;
+    }
+  }
+  else
+  {
+    ; // Pattern is already in the buffer
+  }
+
+  if(result.IsGood())
+  {
+    mode = m;
+    // TIM8 is clocked from APB2 timer clock. Prescaler is used only for rates
+    // below 2.6 kHz where period doesn't fit into 16-bit ARR. Period is
+    // rounded to the nearest count, actual rate is kept for display.
+    uint32_t clk = HAL_RCC_GetPCLK2Freq() * 2U;
+    uint32_t ticks = (clk + r / 2U) / r;
+    uint32_t psc = (ticks - 1U) / 65536U;
+    uint32_t arr = (ticks + (psc + 1U) / 2U) / (psc + 1U) - 1U;
+    uint32_t div = (psc + 1U) * (arr + 1U);
+    rate = (clk + div / 2U) / div;
+    htim8.Instance->PSC = psc;
+    htim8.Instance->ARR = arr;
+    // Load prescaler and clear update flag before DMA request is enabled
+    htim8.Instance->EGR = TIM_EGR_UG;
+    htim8.Instance->SR = 0U;
+
+    if(mode == MODE_LOOP)
+    {
+      // Circular DMA without interrupts
+      StartDma(len, DMA_CIRCULAR, false);
+    }
+    else if(mode == MODE_BURST)
+    {
+      if(repeat == 0U) repeat = 1U;
+      if((uint64_t)len * repeat <= sizeof(buf))
+      {
+        // Replicate pattern, so all repeats are output by one transfer
+        for(uint32_t i = 1U; i < repeat; i++)
+        {
+          memcpy(&buf[i * len], buf, len);
+        }
+        pass_len = len * repeat;
+        passes_left = 1U;
+      }
+      else
+      {
+        pass_len = len;
+        passes_left = repeat;
+      }
+      StartDma(pass_len, DMA_NORMAL, true);
+    }
+    else
+    {
+      // Ping-pong buffer refilled by pattern task
+      StartDma(sizeof(buf), DMA_CIRCULAR, true);
+    }
+
+    // Every update event requests one byte
+    __HAL_TIM_ENABLE_DMA(&htim8, TIM_DMA_UPDATE);
+    running = true;
+    htim8.Instance->CR1 |= TIM_CR1_CEN;
+  }
+  file_mutex.Release();
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Stop   ****************************************************************
+// *****************************************************************************
+void PatternGen::Stop()
+{
+  StopOutput();
+  // Stream file, pattern task may be reading it now
+  file_mutex.Lock();
+  CloseFile();
+  file_mutex.Release();
+}
+
+// *****************************************************************************
+// ***   Process   *************************************************************
+// *****************************************************************************
+void PatternGen::Process()
+{
+  if(IsStreaming() && file_open)
+  {
+    for(uint32_t i = 0U; i < NumberOf(empty); i++)
+    {
+      if(empty[i])
+      {
+        ReadFile(&buf[i * (sizeof(buf) / 2U)], sizeof(buf) / 2U);
+        empty[i] = false;
+      }
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   DmaCallback   *********************************************************
+// *****************************************************************************
+void PatternGen::DmaCallback(uint32_t half)
+{
+  if(mode == MODE_STREAM)
+  {
+    // Other half is output now, if it isn't refilled yet old data is repeated
+    if(empty[half ^ 1U]) underruns++;
+    empty[half] = true;
+    // Wake pattern task to refill this half
+    NotifyFromIsr();
+  }
+  else if(mode == MODE_BURST)
+  {
+    // Normal DMA mode, called only when pass is complete
+    if(passes_left > 1U)
+    {
+      passes_left--;
+      // Update request that came while DMA was disabled stays pending, so
+      // pass is seamless if restart is faster than one word
+      (void) HAL_DMA_Start_IT(htim8.hdma[TIM_DMA_ID_UPDATE], (uint32_t)buf, GetOutputAddress(), pass_len);
+    }
+    else
+    {
+      // Last byte stays on the pins
+      passes_left = 0U;
+      StopOutput();
+    }
+  }
+  else
+  {
+    ; // Loop mode doesn't use interrupts
+  }
+}
+
+// *****************************************************************************
+// ***   Mount   ***************************************************************
+// *****************************************************************************
+Result PatternGen::Mount()
+{
+  Result result;
+
+  if(!mounted)
+  {
+    mounted = (f_mount(&SDFatFS, SDPath, 1U) == FR_OK);
+  }
+  if(!mounted)
+  {
+    result = Result::ERR_BAD_PARAMETER;
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   ReadFile   ************************************************************
+// *****************************************************************************
+void PatternGen::ReadFile(uint8_t* ptr, uint32_t size)
+{
+  while(size > 0U)
+  {
+    UINT br = 0U;
+    if(f_read(&SDFile, ptr, size, &br) != FR_OK)
+    {
+      // Read error: output zeros instead of old data
+      memset(ptr, 0, size);
+      break;
+    }
+    // End of file - play it again from the beginning
+    if(br == 0U)
+    {
+      if(f_lseek(&SDFile, 0U) != FR_OK)
+      {
+        memset(ptr, 0, size);
+        break;
+      }
+    }
+    ptr += br;
+    size -= br;
+  }
+}
+
+// *****************************************************************************
+// ***   CloseFile   ***********************************************************
+// *****************************************************************************
+void PatternGen::CloseFile()
+{
+  if(file_open)
+  {
+    (void) f_close(&SDFile);
+    file_open = false;
+  }
+}
+
+// *****************************************************************************
+// ***   TakeUsbPattern   ******************************************************
+// *****************************************************************************
+void PatternGen::TakeUsbPattern()
+{
+  if(usb_ready)
+  {
+    // Buffer will be overwritten
+    StopOutput();
+    CloseFile();
+    len = usb_ready_len;
+    memcpy(buf, usb_buf, len);
+    // Staging buffer can receive next pattern
+    usb_ready = false;
+  }
+}
+
+// *****************************************************************************
+// ***   NotifyFromIsr   *******************************************************
+// *****************************************************************************
+void PatternGen::NotifyFromIsr()
+{
+  if(task_handle != nullptr)
+  {
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(task_handle, &woken);
+    portYIELD_FROM_ISR(woken);
+  }
+}
+
+// *****************************************************************************
+// ***   StopOutput   **********************************************************
+// *****************************************************************************
+void PatternGen::StopOutput()
+{
+  // Only registers and DMA abort, so it can be called from interrupt
+  htim8.Instance->CR1 &= ~TIM_CR1_CEN;
+  __HAL_TIM_DISABLE_DMA(&htim8, TIM_DMA_UPDATE);
+  (void) HAL_DMA_Abort_IT(htim8.hdma[TIM_DMA_ID_UPDATE]);
+  running = false;
+}
+
+// *****************************************************************************
+// ***   StartDma   ************************************************************
+// *****************************************************************************
+void PatternGen::StartDma(uint32_t size, uint32_t dma_mode, bool irq)
+{
+  DMA_HandleTypeDef* hdma = htim8.hdma[TIM_DMA_ID_UPDATE];
+  // Mode can be changed only when stream is disabled
+  hdma->Init.Mode = dma_mode;
+  (void) HAL_DMA_Init(hdma);
+  // Half transfer interrupt is enabled by HAL only if callback is set
+  hdma->XferHalfCpltCallback = (irq && (dma_mode == DMA_CIRCULAR)) ? &DmaHalfCpltCallback : nullptr;
+  hdma->XferCpltCallback = &DmaCpltCallback;
+  if(irq) (void) HAL_DMA_Start_IT(hdma, (uint32_t)buf, GetOutputAddress(), size);
+  else    (void) HAL_DMA_Start(hdma, (uint32_t)buf, GetOutputAddress(), size);
+}
+
+// *****************************************************************************
+// ***   GetOutputAddress   ****************************************************
+// *****************************************************************************
+uint32_t PatternGen::GetOutputAddress()
+{
+  // Byte access to the high byte of ODR changes only PB8-PB15
+  return (uint32_t)&PAT_OUT_GPIO_Port->ODR + 1U;
+}
+
+// *****************************************************************************
+// ***   HAL DMA callbacks   ***************************************************
+// *****************************************************************************
+void PatternGen::DmaHalfCpltCallback(DMA_HandleTypeDef* hdma)
+{
+  GetInstance().DmaCallback(0U);
+}
+
+void PatternGen::DmaCpltCallback(DMA_HandleTypeDef* hdma)
+{
+  GetInstance().DmaCallback(1U);
+}
+
+// *****************************************************************************
+// ***   USB CDC receive hook   ************************************************
+// *****************************************************************************
+extern "C" void PatternGenUsbReceive(uint8_t* buf, uint32_t len)
+{
+  PatternGen::GetInstance().UsbReceive(buf, len);
+}
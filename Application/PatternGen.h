@@ -0,0 +1,231 @@
+//******************************************************************************
+//  @file PatternGen.h
+//  @author Nicolai Shlapunov
+//
+//  @details Application: Parallel Pattern Generator Class, header
+//
+//  @copyright Copyright (c) 2016, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef PatternGen_h
+#define PatternGen_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+#include "AppTask.h"
+#include "RtosMutex.h"
+
+// *****************************************************************************
+// ***   PatternGen Class   ****************************************************
+// *****************************************************************************
+//
+// 8-bit parallel pattern generator on PB8-PB15. TIM8 update event requests
+// DMA2 Stream1 transfer of one pattern byte to the high byte of GPIOB ODR,
+// so word rate is paced by hardware and low byte of port isn't touched.
+// Only DMA2 can access GPIO, TIM8_UP is the only free timer request on it.
+//
+// Pattern is loaded from file on SD card or over USB CDC: 4 bytes of length
+// (little endian) followed by pattern bytes. USB interrupt only stages the
+// pattern, output is stopped and buffer is replaced by pattern task.
+//
+// Modes:
+//  - Loop: circular DMA repeats pattern forever without CPU load.
+//  - Burst: pattern is output given number of times, then last byte stays on
+//    the pins. If repeats fit into buffer, pattern is replicated and output by
+//    one DMA transfer with exact timing. Otherwise DMA is restarted from
+//    interrupt and repeats are seamless only if interrupt latency is shorter
+//    than one word.
+//  - Stream: file is played from SD card through ping-pong buffer, halves are
+//    refilled by own task woken by DMA interrupt, so refill doesn't depend on
+//    UI loop period. File is repeated at the end.
+//
+class PatternGen : public AppTask
+{
+  public:
+    // *************************************************************************
+    // ***   Enum with all modes   *********************************************
+    // *************************************************************************
+    typedef enum : uint8_t
+    {
+      MODE_LOOP = 0U,
+      MODE_BURST,
+      MODE_STREAM,
+      MODE_CNT
+    } ModeType;
+
+    // Maximum word rate from buffer. Estimate, not measured on hardware:
+    // transfer to GPIO takes about ten AHB cycles, but DMA2 is shared with
+    // display SPI and SDIO streams, so limit leaves margin for them.
+    static const uint32_t MAX_RATE = 10000000U;
+    // Maximum word rate in stream mode limited by SD card read speed: one half
+    // of buffer should be read faster than other half is output. Estimate, not
+    // measured on hardware.
+    static const uint32_t MAX_STREAM_RATE = 1000000U;
+    // Pattern buffer size
+    static const uint32_t MAX_LEN = 16384U;
+
+    // *************************************************************************
+    // ***   Get Instance   ****************************************************
+    // *************************************************************************
+    static PatternGen& GetInstance(void);
+
+    // *************************************************************************
+    // ***   PatternGen Loop   *************************************************
+    // *************************************************************************
+    // Waits for DMA interrupt notification and refills stream buffer
+    virtual Result Loop();
+
+    // *************************************************************************
+    // ***   LoadFile   ********************************************************
+    // *************************************************************************
+    // Load pattern from file on SD card, file longer than buffer is truncated
+    Result LoadFile(const char* name);
+
+    // *************************************************************************
+    // ***   UsbReceive   ******************************************************
+    // *************************************************************************
+    // Called from USB interrupt with received data
+    void UsbReceive(const uint8_t* data, uint32_t len);
+
+    // *************************************************************************
+    // ***   Start   ***********************************************************
+    // *************************************************************************
+    // Repeat used only in burst mode. Stream mode plays file given by name.
+    Result Start(ModeType mode, uint32_t rate, uint32_t repeat, const char* name);
+
+    // *************************************************************************
+    // ***   Stop   ************************************************************
+    // *************************************************************************
+    void Stop();
+
+    // *************************************************************************
+    // ***   DmaCallback   *****************************************************
+    // *************************************************************************
+    // Called from DMA interrupt when half of buffer is transferred
+    void DmaCallback(uint32_t half);
+
+    // *************************************************************************
+    // ***   Getters   *********************************************************
+    // *************************************************************************
+    bool IsRunning() {return running;}
+    bool IsStreaming() {return running && (mode == MODE_STREAM);}
+    uint32_t GetLen() {return len;}
+    uint32_t GetRate() {return rate;}
+    uint32_t GetUnderruns() {return underruns;}
+
+  private:
+    // Pattern buffer, in stream mode used as ping-pong buffer
+    uint8_t buf[MAX_LEN] = {0};
+    // Pattern length
+    uint32_t len = 0U;
+    // Bytes in one burst pass
+    uint32_t pass_len = 0U;
+    // Current mode and actual word rate
+    ModeType mode = MODE_LOOP;
+    uint32_t rate = 0U;
+    // Burst passes left
+    volatile uint32_t passes_left = 0U;
+    // Stream halves to refill
+    volatile bool empty[2U] = {false, false};
+    // Stream buffer underruns
+    volatile uint32_t underruns = 0U;
+    // File system is mounted and stream file is open
+    bool mounted = false;
+    bool file_open = false;
+    // Output is running
+    volatile bool running = false;
+    // Pattern task handle for notification from DMA and USB interrupts
+    TaskHandle_t task_handle = nullptr;
+    // Pattern buffer and stream file are accessed from pattern task and from
+    // caller of Start(), Stop() and LoadFile()
+    RtosMutex file_mutex;
+
+    // Pattern received over USB is staged here by interrupt and copied to
+    // pattern buffer by pattern task
+    uint8_t usb_buf[MAX_LEN] = {0};
+    // USB load state: length bytes received, pattern length and bytes
+    // received
+    uint32_t usb_hdr_cnt = 0U;
+    uint32_t usb_len = 0U;
+    uint32_t usb_pos = 0U;
+    // Received pattern waits for pattern task, pattern being received is
+    // dropped because staging buffer is in use
+    volatile bool usb_ready = false;
+    uint32_t usb_ready_len = 0U;
+    bool usb_skip = false;
+
+    // *************************************************************************
+    // ***   Mount   ***********************************************************
+    // *************************************************************************
+    Result Mount();
+
+    // *************************************************************************
+    // ***   ReadFile   ********************************************************
+    // *************************************************************************
+    // Read data from stream file, rewinds file at the end
+    void ReadFile(uint8_t* ptr, uint32_t size);
+
+    // *************************************************************************
+    // ***   Process   *********************************************************
+    // *************************************************************************
+    // Refill empty halves of stream buffer
+    void Process();
+
+    // *************************************************************************
+    // ***   CloseFile   *******************************************************
+    // *************************************************************************
+    // Close stream file if it is open
+    void CloseFile();
+
+    // *************************************************************************
+    // ***   TakeUsbPattern   **************************************************
+    // *************************************************************************
+    // Stop output and copy pattern received over USB to pattern buffer
+    void TakeUsbPattern();
+
+    // *************************************************************************
+    // ***   NotifyFromIsr   ***************************************************
+    // *************************************************************************
+    // Wake pattern task from interrupt
+    void NotifyFromIsr();
+
+    // *************************************************************************
+    // ***   StopOutput   ******************************************************
+    // *************************************************************************
+    // Stop timer and DMA, file stays open
+    void StopOutput();
+
+    // *************************************************************************
+    // ***   StartDma   ********************************************************
+    // *************************************************************************
+    void StartDma(uint32_t size, uint32_t dma_mode, bool irq);
+
+    // *************************************************************************
+    // ***   GetOutputAddress   ************************************************
+    // *************************************************************************
+    static uint32_t GetOutputAddress();
+
+    // *************************************************************************
+    // ***   HAL DMA callbacks   ***********************************************
+    // *************************************************************************
+    static void DmaHalfCpltCallback(DMA_HandleTypeDef* hdma);
+    static void DmaCpltCallback(DMA_HandleTypeDef* hdma);
+
+    // *************************************************************************
+    // ***   Private constructor   *********************************************
+    // *************************************************************************
+    PatternGen() : AppTask(PATTERNGEN_TASK_STACK_SIZE, PATTERNGEN_TASK_PRIORITY,
+                           "PatternGen") {};
+};
+
+#endif
@@ -0,0 +1,136 @@
+//******************************************************************************
+//  @file RleImage.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details Application: RLE Compressed Image Visual Object Class, implementation
+//
+//  @copyright Copyright (c) 2016, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "RleImage.h"
+
+// *****************************************************************************
+// ***   SetImage   ************************************************************
+// *****************************************************************************
+void RleImage::SetImage(const RleImageDesc& img_dsc)
+{
+  LockVisObject();
+  img = &img_dsc;
+  width = img_dsc.width;
+  height = img_dsc.height;
+  x_end = x_start + width - 1;
+  y_end = y_start + height - 1;
+  UnlockVisObject();
+  // Invalidate area
+  InvalidateObj();
+}
+
+// *****************************************************************************
+// ***   Put line in buffer   **************************************************
+// *****************************************************************************
+void RleImage::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
+{
+  // Draw only if needed
+  if((img != nullptr) && (line >= y_start) && (line <= y_end))
+  {
+    const uint8_t* ptr = img->data + img->line_offset[line - y_start];
+    // Position of the first image pixel in the buffer
+    int32_t idx = x_start - start_x;
+    int32_t idx_end = idx + width;
+    // Decode packets until line end or buffer end
+    while((idx < idx_end) && (idx < n))
+    {
+      int32_t cnt = (*ptr & 0x7F) + 1;
+      bool is_run = (*ptr & 0x80) != 0U;
+      ptr++;
+      if(is_run)
+      {
+        int32_t color = *ptr++;
+        // Skip run entirely if it is transparent or out of buffer
+        if((color != img->transparent_color) && (idx + cnt > 0))
+        {
+          color_t pixel = img->palette[color];
+          int32_t start = (idx < 0) ? 0 : idx;
+          int32_t end = (idx + cnt > n) ? n : idx + cnt;
+          for(int32_t i = start; i < end; i++) buf[i] = pixel;
+        }
+        idx += cnt;
+      }
+      else
+      {
+        for(int32_t i = 0; i < cnt; i++, idx++)
+        {
+          int32_t color = *ptr++;
+          if((idx >= 0) && (idx < n) && (color != img->transparent_color))
+          {
+            buf[idx] = img->palette[color];
+          }
+        }
+      }
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Put line in buffer   **************************************************
+// *****************************************************************************
+void RleImage::DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y)
+{
+  // Draw only if needed
+  if((img != nullptr) && (row >= x_start) && (row <= x_end))
+  {
+    // Find start y position in buffer
+    int32_t start = y_start - start_y;
+    for(int32_t y = 0; y < height; y++)
+    {
+      int32_t idx = start + y;
+      if((idx >= 0) && (idx < n))
+      {
+        int32_t color = GetPixel(row - x_start, y);
+        if(color != img->transparent_color)
+        {
+          buf[idx] = img->palette[color];
+        }
+      }
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   GetPixel   ************************************************************
+// *****************************************************************************
+int32_t RleImage::GetPixel(int32_t x, int32_t y)
+{
+  const uint8_t* ptr = img->data + img->line_offset[y];
+  int32_t color = img->transparent_color;
+
+  // Skip packets before requested pixel
+  while(x >= 0)
+  {
+    int32_t cnt = (*ptr & 0x7F) + 1;
+    if(*ptr & 0x80)
+    {
+      if(x < cnt) color = ptr[1];
+      ptr += 2;
+    }
+    else
+    {
+      if(x < cnt) color = ptr[1 + x];
+      ptr += 1 + cnt;
+    }
+    x -= cnt;
+  }
+
+  return color;
+}
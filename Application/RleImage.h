@@ -0,0 +1,79 @@
+//******************************************************************************
+//  @file RleImage.h
+//  @author Nicolai Shlapunov
+//
+//  @details Application: RLE Compressed Image Visual Object Class, header
+//
+//  @copyright Copyright (c) 2016, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef RleImage_h
+#define RleImage_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+#include "DisplayDrv.h"
+
+// *****************************************************************************
+// ***   RLE Image Description   ***********************************************
+// *****************************************************************************
+//
+// Images generated by Resouces/bmp2rle.py. Each line encoded separately and
+// line_offset[] contains offset of each line in data[], so display driver can
+// request any line without decoding previous ones. Each line consists from
+// packets:
+//   0x80 | (N - 1), C       - run of N pixels of palette color C
+//   N - 1, C0, C1, ... CN-1 - N literal pixels
+//
+typedef struct
+{
+  int32_t width;             // Image width
+  int32_t height;            // Image height
+  const uint16_t* line_offset; // Offset of each line in data array
+  const uint8_t* data;       // RLE compressed palette indexes
+  const color_t* palette;    // Palette
+  int32_t transparent_color; // Transparent palette index or -1 if not used
+} RleImageDesc;
+
+// *****************************************************************************
+// ***   RleImage Class   ******************************************************
+// *****************************************************************************
+class RleImage : public VisObject
+{
+  public:
+    // *************************************************************************
+    // ***   SetImage   ********************************************************
+    // *************************************************************************
+    void SetImage(const RleImageDesc& img_dsc);
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x = 0);
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y = 0);
+
+  private:
+    // Image description
+    const RleImageDesc* img = nullptr;
+
+    // *************************************************************************
+    // ***   GetPixel   ********************************************************
+    // *************************************************************************
+    int32_t GetPixel(int32_t x, int32_t y);
+};
+
+#endif
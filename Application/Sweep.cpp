@@ -0,0 +1,74 @@
+//******************************************************************************
+//  @file Sweep.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details Application: Frequency Sweep Class, implementation
+//
+//  @copyright Copyright (c) 2016, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "Sweep.h"
+
+#include <cmath>
+
+// *****************************************************************************
+// ***   Setup   ***************************************************************
+// *****************************************************************************
+void Sweep::Setup(float start, float stop, uint32_t duration_ms, LawType l, DirType d, uint32_t step_us)
+{
+  law = l;
+  dir = d;
+  // Count of steps in one leg, at least one
+  steps = (uint32_t)(((uint64_t)duration_ms * 1000U) / step_us);
+  if(steps == 0U) steps = 1U;
+  // Down sweep goes from stop frequency
+  if(dir == DIR_DOWN) StartLeg(stop, start);
+  else                StartLeg(start, stop);
+}
+
+// *****************************************************************************
+// ***   Step   ****************************************************************
+// *****************************************************************************
+float Sweep::Step()
+{
+  idx++;
+  if(idx < steps)
+  {
+    // Frequency is computed from step index, so rounding errors of float
+    // don't accumulate over long leg
+    if(law == LAW_LOG) freq = leg_begin * expf(k * idx);
+    else               freq = leg_begin + k * idx;
+  }
+  else // End of leg
+  {
+    if(dir == DIR_PINGPONG) StartLeg(leg_end, leg_begin);
+    else                    StartLeg(leg_begin, leg_end);
+  }
+  return freq;
+}
+
+// *****************************************************************************
+// ***   StartLeg   ************************************************************
+// *****************************************************************************
+void Sweep::StartLeg(float begin, float end)
+{
+  leg_begin = begin;
+  leg_end = end;
+  // Frequency recalculated from begin of every leg, so rounding errors
+  // doesn't accumulate between legs
+  freq = begin;
+  idx = 0U;
+  if(law == LAW_LOG) k = logf(end / begin) / steps;
+  else               k = (end - begin) / steps;
+}
@@ -0,0 +1,102 @@
+//******************************************************************************
+//  @file Sweep.h
+//  @author Nicolai Shlapunov
+//
+//  @details Application: Frequency Sweep Class, header
+//
+//  @copyright Copyright (c) 2016, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef Sweep_h
+#define Sweep_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include <cstdint>
+
+// *****************************************************************************
+// ***   Sweep Class   *********************************************************
+// *****************************************************************************
+//
+// Frequency sweep engine. Sweep time is divided to equal steps and Step()
+// should be called once per step from the DMA interrupt that refills output
+// buffer, so sweep is paced by hardware and doesn't depend on task timing.
+// Linear law adds constant delta every step, logarithmic law multiplies
+// frequency by constant ratio every step, so every decade takes same time.
+// Step() computes frequency from step index with one multiply-add or one
+// expf(), so it is cheap enough to call it from interrupt and float rounding
+// doesn't accumulate over the leg.
+//
+class Sweep
+{
+  public:
+    // *************************************************************************
+    // ***   Enum with sweep laws   ********************************************
+    // *************************************************************************
+    typedef enum : uint8_t
+    {
+      LAW_LIN = 0U,
+      LAW_LOG,
+      LAW_CNT
+    } LawType;
+
+    // *************************************************************************
+    // ***   Enum with sweep directions   **************************************
+    // *************************************************************************
+    typedef enum : uint8_t
+    {
+      DIR_UP = 0U,   // Start to stop, then jump to start
+      DIR_DOWN,      // Stop to start, then jump to stop
+      DIR_PINGPONG,  // Start to stop and back
+      DIR_CNT
+    } DirType;
+
+    // *************************************************************************
+    // ***   Setup   ***********************************************************
+    // *************************************************************************
+    // Duration is time of one leg of sweep(start to stop)
+    void Setup(float start, float stop, uint32_t duration_ms, LawType law, DirType dir, uint32_t step_us);
+
+    // *************************************************************************
+    // ***   Step   ************************************************************
+    // *************************************************************************
+    // Advance sweep to the next step and return new frequency
+    float Step();
+
+    // *************************************************************************
+    // ***   GetFrequency   ****************************************************
+    // *************************************************************************
+    float GetFrequency() {return freq;}
+
+  private:
+    // Begin and end frequency of current leg
+    float leg_begin = 0.0F;
+    float leg_end = 0.0F;
+    // Current frequency
+    float freq = 0.0F;
+    // Delta(linear law) or natural log of ratio(logarithmic law) per step
+    float k = 0.0F;
+    // Steps in one leg
+    uint32_t steps = 1U;
+    // Current step in leg
+    uint32_t idx = 0U;
+    // Sweep parameters
+    LawType law = LAW_LIN;
+    DirType dir = DIR_UP;
+
+    // *************************************************************************
+    // ***   StartLeg   ********************************************************
+    // *************************************************************************
+    void StartLeg(float begin, float end);
+};
+
+#endif
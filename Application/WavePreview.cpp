@@ -0,0 +1,146 @@
+//******************************************************************************
+//  @file WavePreview.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details Application: Waveform Preview Visual Object Class, implementation
+//
+//  @copyright Copyright (c) 2016, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "WavePreview.h"
+
+// *****************************************************************************
+// ***   SetParams   ***********************************************************
+// *****************************************************************************
+void WavePreview::SetParams(int32_t x, int32_t y, int32_t w, int32_t h, color_t trace, color_t bg, color_t grid)
+{
+  // Limit size by buffers and column values
+  if(w > (int32_t)MAX_W) w = MAX_W;
+  if(h > UINT8_MAX) h = UINT8_MAX;
+
+  LockVisObject();
+  x_start = x;
+  y_start = y;
+  width = w;
+  height = h;
+  x_end = x + w - 1;
+  y_end = y + h - 1;
+  trace_color = trace;
+  bg_color = bg;
+  grid_color = grid;
+  // Flat line in the middle until data is set
+  for(int32_t i = 0; i < width; i++)
+  {
+    col_top[i] = height / 2;
+    col_bottom[i] = height / 2;
+  }
+  UnlockVisObject();
+  // Invalidate area
+  InvalidateObj();
+}
+
+// *****************************************************************************
+// ***   SetData   *************************************************************
+// *****************************************************************************
+bool WavePreview::SetData(const uint16_t* data, uint32_t cnt, uint16_t max_val)
+{
+  bool changed = false;
+
+  if((data != nullptr) && (cnt > 0U) && (max_val > 0U) && (width > 0))
+  {
+    LockVisObject();
+    for(int32_t col = 0; col < width; col++)
+    {
+      // Samples range for column. Range includes first sample of next column to
+      // connect columns with vertical segment.
+      uint32_t start = (col * cnt) / width;
+      uint32_t end = ((col + 1U) * cnt) / width;
+      if(end >= cnt) end = cnt - 1U;
+      // Find min & max
+      uint16_t min = data[start];
+      uint16_t max = data[start];
+      for(uint32_t i = start + 1U; i <= end; i++)
+      {
+        if(data[i] < min) min = data[i];
+        if(data[i] > max) max = data[i];
+      }
+      if(max > max_val) max = max_val;
+      if(min > max_val) min = max_val;
+      // Bigger value should be higher on the screen
+      uint8_t top = ((max_val - max) * (height - 1)) / max_val;
+      uint8_t bottom = ((max_val - min) * (height - 1)) / max_val;
+      // Store only if changed
+      if((top != col_top[col]) || (bottom != col_bottom[col]))
+      {
+        col_top[col] = top;
+        col_bottom[col] = bottom;
+        changed = true;
+      }
+    }
+    UnlockVisObject();
+    // Invalidate area only if something changed
+    if(changed)
+    {
+      InvalidateObj();
+    }
+  }
+
+  return changed;
+}
+
+// *****************************************************************************
+// ***   Put line in buffer   **************************************************
+// *****************************************************************************
+void WavePreview::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
+{
+  // Draw only if needed
+  if((line >= y_start) && (line <= y_end))
+  {
+    int32_t y = line - y_start;
+    // Find start x position in buffer
+    int32_t start = x_start - start_x;
+    // Draw only columns inside buffer
+    for(int32_t col = 0; col < width; col++)
+    {
+      int32_t idx = start + col;
+      if((idx >= 0) && (idx < n))
+      {
+        buf[idx] = GetPixel(col, y);
+      }
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Put line in buffer   **************************************************
+// *****************************************************************************
+void WavePreview::DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y)
+{
+  // Draw only if needed
+  if((row >= x_start) && (row <= x_end))
+  {
+    int32_t col = row - x_start;
+    // Find start y position in buffer
+    int32_t start = y_start - start_y;
+    // Draw only lines inside buffer
+    for(int32_t y = 0; y < height; y++)
+    {
+      int32_t idx = start + y;
+      if((idx >= 0) && (idx < n))
+      {
+        buf[idx] = GetPixel(col, y);
+      }
+    }
+  }
+}
@@ -0,0 +1,84 @@
+//******************************************************************************
+//  @file WavePreview.h
+//  @author Nicolai Shlapunov
+//
+//  @details Application: Waveform Preview Visual Object Class, header
+//
+//  @copyright Copyright (c) 2016, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef WavePreview_h
+#define WavePreview_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+#include "DisplayDrv.h"
+
+// *****************************************************************************
+// ***   WavePreview Class   ***************************************************
+// *****************************************************************************
+//
+// Small oscilloscope-like view of the DAC buffer. Buffer is decimated to one
+// min/max pair per column, so preview shows all peaks even if buffer contains
+// much more samples than preview width. Object invalidated only if at least one
+// column is changed.
+//
+class WavePreview : public VisObject
+{
+  public:
+    // Maximum preview width in pixels
+    static const uint32_t MAX_W = 80U;
+
+    // *************************************************************************
+    // ***   SetParams   *******************************************************
+    // *************************************************************************
+    void SetParams(int32_t x, int32_t y, int32_t w, int32_t h, color_t trace = COLOR_GREEN, color_t bg = COLOR_BLACK, color_t grid = COLOR_DARKGREY);
+
+    // *************************************************************************
+    // ***   SetData   *********************************************************
+    // *************************************************************************
+    // Returns true if preview is changed and object invalidated
+    bool SetData(const uint16_t* data, uint32_t cnt, uint16_t max_val);
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x = 0);
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y = 0);
+
+  private:
+    // Top and bottom trace position for each column
+    uint8_t col_top[MAX_W] = {0};
+    uint8_t col_bottom[MAX_W] = {0};
+    // Colors
+    color_t trace_color = COLOR_GREEN;
+    color_t bg_color = COLOR_BLACK;
+    color_t grid_color = COLOR_DARKGREY;
+
+    // *************************************************************************
+    // ***   GetPixel   ********************************************************
+    // *************************************************************************
+    inline color_t GetPixel(int32_t col, int32_t y)
+    {
+      color_t color = bg_color;
+      if((y >= col_top[col]) && (y <= col_bottom[col])) color = trace_color;
+      else if((y == height / 2) && ((col & 1) == 0))    color = grid_color;
+      return color;
+    }
+};
+
+#endif
@@ -91,7 +91,29 @@ void Error_Handler(void);
 #define BUZZER_GPIO_Port GPIOB
 
 /* USER CODE BEGIN Private defines */
-
+#define TRIG_IN_Pin GPIO_PIN_6
+#define TRIG_IN_GPIO_Port GPIOA
+#define PAT_OUT_Pins (GPIO_PIN_8|GPIO_PIN_9|GPIO_PIN_10|GPIO_PIN_11|GPIO_PIN_12|GPIO_PIN_13|GPIO_PIN_14|GPIO_PIN_15)
+#define PAT_OUT_GPIO_Port GPIOB
+#define COMPL_OUT_Pin GPIO_PIN_8
+#define COMPL_OUTN_Pin GPIO_PIN_7
+#define COMPL_OUT_GPIO_Port GPIOA
+#define COMPL_BKIN_Pin GPIO_PIN_12
+#define COMPL_BKIN_GPIO_Port GPIOB
+#define PHASE_TIM2_OUT_Pin GPIO_PIN_11
+#define PHASE_TIM2_OUT_GPIO_Port GPIOB
+#define PHASE_TIM5_OUT_Pin GPIO_PIN_0
+#define PHASE_TIM5_OUT_GPIO_Port GPIOA
+#define PHASE_TIM1_OUT_Pins (GPIO_PIN_9|GPIO_PIN_10)
+#define PHASE_TIM1_OUT_GPIO_Port GPIOA
+#define PWM_CH3_OUT_Pin GPIO_PIN_3
+#define PWM_CH3_OUT_GPIO_Port GPIOA
+#define PWM_CH4_OUT_Pin GPIO_PIN_2
+#define PWM_CH4_OUT_GPIO_Port GPIOA
+#define STEP_DIR3_Pin GPIO_PIN_1
+#define STEP_DIR3_GPIO_Port GPIOA
+#define STEP_DIR4_Pin GPIO_PIN_6
+#define STEP_DIR4_GPIO_Port GPIOC
 /* USER CODE END Private defines */
 
 #ifdef __cplusplus
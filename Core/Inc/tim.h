@@ -55,7 +55,15 @@ void MX_TIM7_Init(void);
 void HAL_TIM_MspPostInit(TIM_HandleTypeDef *htim);
 
 /* USER CODE BEGIN Prototypes */
-
+extern TIM_HandleTypeDef htim3;
+extern TIM_HandleTypeDef htim8;
+extern TIM_HandleTypeDef htim1;
+extern TIM_HandleTypeDef htim9;
+
+void MX_TIM3_Init(void);
+void MX_TIM8_Init(void);
+void MX_TIM1_Init(void);
+void MX_TIM9_Init(void);
 /* USER CODE END Prototypes */
 
 #ifdef __cplusplus
@@ -109,6 +109,10 @@ int main(void)
   MX_TIM5_Init();
   MX_TIM2_Init();
   /* USER CODE BEGIN 2 */
+  MX_TIM3_Init();
+  MX_TIM8_Init();
+  MX_TIM1_Init();
+  MX_TIM9_Init();
   AppMain();
   /* USER CODE END 2 */
 
@@ -21,7 +21,13 @@
 #include "tim.h"
 
 /* USER CODE BEGIN 0 */
-
+DMA_HandleTypeDef hdma_tim2_up;
+DMA_HandleTypeDef hdma_tim5_up;
+TIM_HandleTypeDef htim8;
+DMA_HandleTypeDef hdma_tim8_up;
+TIM_HandleTypeDef htim3;
+TIM_HandleTypeDef htim1;
+TIM_HandleTypeDef htim9;
 /* USER CODE END 0 */
 
 TIM_HandleTypeDef htim2;
@@ -260,7 +266,27 @@ void HAL_TIM_Base_MspInit(TIM_HandleTypeDef* tim_baseHandle)
     /* TIM2 clock enable */
     __HAL_RCC_TIM2_CLK_ENABLE();
   /* USER CODE BEGIN TIM2_MspInit 1 */
-
+    /* TIM2_UP DMA Init: burst write of ARR and CCRx for streaming modes */
+    hdma_tim2_up.Instance = DMA1_Stream7;
+    hdma_tim2_up.Init.Channel = DMA_CHANNEL_3;
+    hdma_tim2_up.Init.Direction = DMA_MEMORY_TO_PERIPH;
+    hdma_tim2_up.Init.PeriphInc = DMA_PINC_DISABLE;
+    hdma_tim2_up.Init.MemInc = DMA_MINC_ENABLE;
+    hdma_tim2_up.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+    hdma_tim2_up.Init.MemDataAlignment = DMA_MDATAALIGN_WORD;
+    hdma_tim2_up.Init.Mode = DMA_CIRCULAR;
+    hdma_tim2_up.Init.Priority = DMA_PRIORITY_HIGH;
+    hdma_tim2_up.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    if (HAL_DMA_Init(&hdma_tim2_up) != HAL_OK)
+    {
+      Error_Handler();
+    }
+
+    __HAL_LINKDMA(tim_baseHandle,hdma[TIM_DMA_ID_UPDATE],hdma_tim2_up);
+
+    /* DMA1_Stream7_IRQn interrupt configuration */
+    HAL_NVIC_SetPriority(DMA1_Stream7_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(DMA1_Stream7_IRQn);
   /* USER CODE END TIM2_MspInit 1 */
   }
   else if(tim_baseHandle->Instance==TIM5)
@@ -271,7 +297,27 @@ void HAL_TIM_Base_MspInit(TIM_HandleTypeDef* tim_baseHandle)
     /* TIM5 clock enable */
     __HAL_RCC_TIM5_CLK_ENABLE();
   /* USER CODE BEGIN TIM5_MspInit 1 */
-
+    /* TIM5_UP DMA Init: burst write of ARR and CCRx for streaming modes */
+    hdma_tim5_up.Instance = DMA1_Stream0;
+    hdma_tim5_up.Init.Channel = DMA_CHANNEL_6;
+    hdma_tim5_up.Init.Direction = DMA_MEMORY_TO_PERIPH;
+    hdma_tim5_up.Init.PeriphInc = DMA_PINC_DISABLE;
+    hdma_tim5_up.Init.MemInc = DMA_MINC_ENABLE;
+    hdma_tim5_up.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+    hdma_tim5_up.Init.MemDataAlignment = DMA_MDATAALIGN_WORD;
+    hdma_tim5_up.Init.Mode = DMA_CIRCULAR;
+    hdma_tim5_up.Init.Priority = DMA_PRIORITY_HIGH;
+    hdma_tim5_up.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    if (HAL_DMA_Init(&hdma_tim5_up) != HAL_OK)
+    {
+      Error_Handler();
+    }
+
+    __HAL_LINKDMA(tim_baseHandle,hdma[TIM_DMA_ID_UPDATE],hdma_tim5_up);
+
+    /* DMA1_Stream0_IRQn interrupt configuration */
+    HAL_NVIC_SetPriority(DMA1_Stream0_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(DMA1_Stream0_IRQn);
   /* USER CODE END TIM5_MspInit 1 */
   }
   else if(tim_baseHandle->Instance==TIM6)
@@ -334,7 +380,17 @@ void HAL_TIM_MspPostInit(TIM_HandleTypeDef* timHandle)
     HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
 
   /* USER CODE BEGIN TIM2_MspPostInit 1 */
-
+    /* PB11 is TIM2_CH4 output of interleaved PWM bank, but it is pattern
+       generator output too. Application switches it to TIM2 only while bank
+       outputs phase on it. */
+    /* PC6 ------> direction output of stepper mode */
+    __HAL_RCC_GPIOC_CLK_ENABLE();
+    HAL_GPIO_WritePin(STEP_DIR4_GPIO_Port, STEP_DIR4_Pin, GPIO_PIN_RESET);
+    GPIO_InitStruct.Pin = STEP_DIR4_Pin;
+    GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+    GPIO_InitStruct.Pull = GPIO_NOPULL;
+    GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+    HAL_GPIO_Init(STEP_DIR4_GPIO_Port, &GPIO_InitStruct);
   /* USER CODE END TIM2_MspPostInit 1 */
   }
   else if(timHandle->Instance==TIM4)
@@ -376,7 +432,20 @@ void HAL_TIM_MspPostInit(TIM_HandleTypeDef* timHandle)
     HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
 
   /* USER CODE BEGIN TIM5_MspPostInit 1 */
-
+    /* PA0 ------> TIM5_CH1, second output of interleaved PWM bank */
+    GPIO_InitStruct.Pin = PHASE_TIM5_OUT_Pin;
+    GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+    GPIO_InitStruct.Pull = GPIO_PULLDOWN;
+    GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+    GPIO_InitStruct.Alternate = GPIO_AF2_TIM5;
+    HAL_GPIO_Init(PHASE_TIM5_OUT_GPIO_Port, &GPIO_InitStruct);
+    /* PA1 ------> direction output of stepper mode */
+    HAL_GPIO_WritePin(STEP_DIR3_GPIO_Port, STEP_DIR3_Pin, GPIO_PIN_RESET);
+    GPIO_InitStruct.Pin = STEP_DIR3_Pin;
+    GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+    GPIO_InitStruct.Pull = GPIO_NOPULL;
+    GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+    HAL_GPIO_Init(STEP_DIR3_GPIO_Port, &GPIO_InitStruct);
   /* USER CODE END TIM5_MspPostInit 1 */
   }
 
@@ -393,7 +462,8 @@ void HAL_TIM_Base_MspDeInit(TIM_HandleTypeDef* tim_baseHandle)
     /* Peripheral clock disable */
     __HAL_RCC_TIM2_CLK_DISABLE();
   /* USER CODE BEGIN TIM2_MspDeInit 1 */
-
+    /* TIM2 DMA DeInit */
+    HAL_DMA_DeInit(tim_baseHandle->hdma[TIM_DMA_ID_UPDATE]);
   /* USER CODE END TIM2_MspDeInit 1 */
   }
   else if(tim_baseHandle->Instance==TIM5)
@@ -404,7 +474,8 @@ void HAL_TIM_Base_MspDeInit(TIM_HandleTypeDef* tim_baseHandle)
     /* Peripheral clock disable */
     __HAL_RCC_TIM5_CLK_DISABLE();
   /* USER CODE BEGIN TIM5_MspDeInit 1 */
-
+    /* TIM5 DMA DeInit */
+    HAL_DMA_DeInit(tim_baseHandle->hdma[TIM_DMA_ID_UPDATE]);
   /* USER CODE END TIM5_MspDeInit 1 */
   }
   else if(tim_baseHandle->Instance==TIM6)
@@ -449,4 +520,269 @@ void HAL_TIM_OC_MspDeInit(TIM_HandleTypeDef* tim_ocHandle)
 
 /* USER CODE BEGIN 1 */
 
+/* TIM3 init function */
+/* Trigger input: TIM3 free running counter captures edge on TIM3_CH1 and
+   sends TRGO pulse on capture, which starts TIM2 and TIM5 in slave trigger
+   mode. Captured value is timestamp of the edge for latency measurement. */
+void MX_TIM3_Init(void)
+{
+  TIM_MasterConfigTypeDef sMasterConfig = {0};
+  TIM_IC_InitTypeDef sConfigIC = {0};
+
+  htim3.Instance = TIM3;
+  htim3.Init.Prescaler = 0;
+  htim3.Init.CounterMode = TIM_COUNTERMODE_UP;
+  htim3.Init.Period = 65535;
+  htim3.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+  htim3.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+  if (HAL_TIM_IC_Init(&htim3) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sMasterConfig.MasterOutputTrigger = TIM_TRGO_OC1;
+  sMasterConfig.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
+  if (HAL_TIMEx_MasterConfigSynchronization(&htim3, &sMasterConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  /* No input filter: it would add latency */
+  sConfigIC.ICPolarity = TIM_INPUTCHANNELPOLARITY_RISING;
+  sConfigIC.ICSelection = TIM_ICSELECTION_DIRECTTI;
+  sConfigIC.ICPrescaler = TIM_ICPSC_DIV1;
+  sConfigIC.ICFilter = 0;
+  if (HAL_TIM_IC_ConfigChannel(&htim3, &sConfigIC, TIM_CHANNEL_1) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+void HAL_TIM_IC_MspInit(TIM_HandleTypeDef* tim_icHandle)
+{
+
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+  if(tim_icHandle->Instance==TIM3)
+  {
+    /* TIM3 clock enable */
+    __HAL_RCC_TIM3_CLK_ENABLE();
+
+    __HAL_RCC_GPIOA_CLK_ENABLE();
+    /**TIM3 GPIO Configuration
+    PA6     ------> TIM3_CH1
+    */
+    GPIO_InitStruct.Pin = TRIG_IN_Pin;
+    GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+    GPIO_InitStruct.Pull = GPIO_PULLDOWN;
+    GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+    GPIO_InitStruct.Alternate = GPIO_AF2_TIM3;
+    HAL_GPIO_Init(TRIG_IN_GPIO_Port, &GPIO_InitStruct);
+
+    /* TIM3 interrupt Init: above RTOS priorities, so trigger processing isn't
+       delayed by the kernel. Handler must not use RTOS API. */
+    HAL_NVIC_SetPriority(TIM3_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(TIM3_IRQn);
+  }
+}
+
+/* TIM8 init function */
+/* Pattern generator word clock: every update event requests DMA2 Stream1
+   transfer of one byte to PB8-PB15. TIM8 isn't handled by generated
+   HAL_TIM_Base_MspInit(), so clock, DMA and pins are initialized here. */
+void MX_TIM8_Init(void)
+{
+  TIM_ClockConfigTypeDef sClockSourceConfig = {0};
+  TIM_MasterConfigTypeDef sMasterConfig = {0};
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+  /* TIM8 clock enable */
+  __HAL_RCC_TIM8_CLK_ENABLE();
+
+  /* TIM8 DMA Init */
+  /* TIM8_UP Init: mode is changed by pattern generator before start */
+  hdma_tim8_up.Instance = DMA2_Stream1;
+  hdma_tim8_up.Init.Channel = DMA_CHANNEL_7;
+  hdma_tim8_up.Init.Direction = DMA_MEMORY_TO_PERIPH;
+  hdma_tim8_up.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma_tim8_up.Init.MemInc = DMA_MINC_ENABLE;
+  hdma_tim8_up.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma_tim8_up.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+  hdma_tim8_up.Init.Mode = DMA_CIRCULAR;
+  hdma_tim8_up.Init.Priority = DMA_PRIORITY_VERY_HIGH;
+  hdma_tim8_up.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+  if (HAL_DMA_Init(&hdma_tim8_up) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  __HAL_LINKDMA(&htim8,hdma[TIM_DMA_ID_UPDATE],hdma_tim8_up);
+
+  /* DMA2_Stream1_IRQn interrupt configuration */
+  HAL_NVIC_SetPriority(DMA2_Stream1_IRQn, 5, 0);
+  HAL_NVIC_EnableIRQ(DMA2_Stream1_IRQn);
+
+  htim8.Instance = TIM8;
+  htim8.Init.Prescaler = 0;
+  htim8.Init.CounterMode = TIM_COUNTERMODE_UP;
+  htim8.Init.Period = 167;
+  htim8.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+  htim8.Init.RepetitionCounter = 0;
+  htim8.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
+  if (HAL_TIM_Base_Init(&htim8) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sClockSourceConfig.ClockSource = TIM_CLOCKSOURCE_INTERNAL;
+  if (HAL_TIM_ConfigClockSource(&htim8, &sClockSourceConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sMasterConfig.MasterOutputTrigger = TIM_TRGO_RESET;
+  sMasterConfig.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
+  if (HAL_TIMEx_MasterConfigSynchronization(&htim8, &sMasterConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  __HAL_RCC_GPIOB_CLK_ENABLE();
+  /**Pattern generator GPIO Configuration
+  PB8-PB15     ------> Output
+  */
+  HAL_GPIO_WritePin(PAT_OUT_GPIO_Port, PAT_OUT_Pins, GPIO_PIN_RESET);
+  GPIO_InitStruct.Pin = PAT_OUT_Pins;
+  GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+  HAL_GPIO_Init(PAT_OUT_GPIO_Port, &GPIO_InitStruct);
+}
+
+/* TIM1 init function */
+/* Complementary PWM: CH1 on PA8 and CH1N on PA7 with dead-time insertion.
+   Outputs are driven low while MOE is cleared(off-state selection enabled,
+   idle states low), so half-bridge is off until output is started and after
+   break. Break input PB12 is shared with pattern generator output, it is
+   switched to alternate function by application only while complementary
+   output is used. CH2 on PA9 and CH3 on PA10 are outputs of interleaved PWM
+   bank, break is disabled while bank uses them. TIM1 isn't handled by
+   generated code, so clock and pins are initialized here. */
+void MX_TIM1_Init(void)
+{
+  TIM_ClockConfigTypeDef sClockSourceConfig = {0};
+  TIM_MasterConfigTypeDef sMasterConfig = {0};
+  TIM_OC_InitTypeDef sConfigOC = {0};
+  TIM_BreakDeadTimeConfigTypeDef sBreakDeadTimeConfig = {0};
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+  /* TIM1 clock enable */
+  __HAL_RCC_TIM1_CLK_ENABLE();
+
+  htim1.Instance = TIM1;
+  htim1.Init.Prescaler = 0;
+  htim1.Init.CounterMode = TIM_COUNTERMODE_UP;
+  htim1.Init.Period = 65535;
+  htim1.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+  htim1.Init.RepetitionCounter = 0;
+  htim1.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
+  if (HAL_TIM_PWM_Init(&htim1) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sClockSourceConfig.ClockSource = TIM_CLOCKSOURCE_INTERNAL;
+  if (HAL_TIM_ConfigClockSource(&htim1, &sClockSourceConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sMasterConfig.MasterOutputTrigger = TIM_TRGO_RESET;
+  sMasterConfig.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
+  if (HAL_TIMEx_MasterConfigSynchronization(&htim1, &sMasterConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sConfigOC.OCMode = TIM_OCMODE_PWM1;
+  sConfigOC.Pulse = 0;
+  sConfigOC.OCPolarity = TIM_OCPOLARITY_HIGH;
+  sConfigOC.OCNPolarity = TIM_OCNPOLARITY_HIGH;
+  sConfigOC.OCFastMode = TIM_OCFAST_DISABLE;
+  sConfigOC.OCIdleState = TIM_OCIDLESTATE_RESET;
+  sConfigOC.OCNIdleState = TIM_OCNIDLESTATE_RESET;
+  if (HAL_TIM_PWM_ConfigChannel(&htim1, &sConfigOC, TIM_CHANNEL_1) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  __HAL_TIM_ENABLE_OCxPRELOAD(&htim1, TIM_CHANNEL_1);
+  /* Break input is active low, pull-up keeps output enabled if nothing is
+     connected. MOE isn't set back automatically after break. */
+  sBreakDeadTimeConfig.OffStateRunMode = TIM_OSSR_ENABLE;
+  sBreakDeadTimeConfig.OffStateIDLEMode = TIM_OSSI_ENABLE;
+  sBreakDeadTimeConfig.LockLevel = TIM_LOCKLEVEL_OFF;
+  sBreakDeadTimeConfig.DeadTime = 0;
+  sBreakDeadTimeConfig.BreakState = TIM_BREAK_ENABLE;
+  sBreakDeadTimeConfig.BreakPolarity = TIM_BREAKPOLARITY_LOW;
+  sBreakDeadTimeConfig.AutomaticOutput = TIM_AUTOMATICOUTPUT_DISABLE;
+  if (HAL_TIMEx_ConfigBreakDeadTime(&htim1, &sBreakDeadTimeConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+  /**TIM1 GPIO Configuration
+  PA7     ------> TIM1_CH1N
+  PA8     ------> TIM1_CH1
+  */
+  GPIO_InitStruct.Pin = COMPL_OUT_Pin|COMPL_OUTN_Pin;
+  GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+  GPIO_InitStruct.Pull = GPIO_PULLDOWN;
+  GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+  GPIO_InitStruct.Alternate = GPIO_AF1_TIM1;
+  HAL_GPIO_Init(COMPL_OUT_GPIO_Port, &GPIO_InitStruct);
+
+  /**TIM1 GPIO Configuration for interleaved PWM bank
+  PA9     ------> TIM1_CH2
+  PA10    ------> TIM1_CH3
+  */
+  GPIO_InitStruct.Pin = PHASE_TIM1_OUT_Pins;
+  HAL_GPIO_Init(PHASE_TIM1_OUT_GPIO_Port, &GPIO_InitStruct);
+}
+
+/* TIM9 init function */
+/* High resolution PWM: TIM9 counts at APB2 timer clock, twice the clock of
+   TIM2 and TIM5. CH1 is on PA2 and CH2 on PA3, the same pins as TIM2_CH3
+   and TIM5_CH4, application switches pin alternate function to TIM9 while
+   it outputs PWM of the channel. TIM9 isn't handled by generated code, so
+   clock is initialized here. */
+void MX_TIM9_Init(void)
+{
+  TIM_ClockConfigTypeDef sClockSourceConfig = {0};
+  TIM_OC_InitTypeDef sConfigOC = {0};
+
+  /* TIM9 clock enable */
+  __HAL_RCC_TIM9_CLK_ENABLE();
+
+  htim9.Instance = TIM9;
+  htim9.Init.Prescaler = 0;
+  htim9.Init.CounterMode = TIM_COUNTERMODE_UP;
+  htim9.Init.Period = 65535;
+  htim9.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+  htim9.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
+  if (HAL_TIM_PWM_Init(&htim9) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sClockSourceConfig.ClockSource = TIM_CLOCKSOURCE_INTERNAL;
+  if (HAL_TIM_ConfigClockSource(&htim9, &sClockSourceConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sConfigOC.OCMode = TIM_OCMODE_PWM1;
+  sConfigOC.Pulse = 0;
+  sConfigOC.OCPolarity = TIM_OCPOLARITY_HIGH;
+  sConfigOC.OCFastMode = TIM_OCFAST_DISABLE;
+  if (HAL_TIM_PWM_ConfigChannel(&htim9, &sConfigOC, TIM_CHANNEL_1) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  if (HAL_TIM_PWM_ConfigChannel(&htim9, &sConfigOC, TIM_CHANNEL_2) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
 /* USER CODE END 1 */
@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+#*******************************************************************************
+#  @file bmp2rle.py
+#  @author Nicolai Shlapunov
+#
+#  @details Converts 24-bit BMP file into RLE compressed 8-bit palette images
+#           for the RleImage visual object. Source BMP can contain several
+#           images of the same size placed one under other.
+#
+#  Usage: bmp2rle.py waveforms.bmp 56 waveforms ../Application/Images.h
+#
+#  RLE format: each image line encoded separately, line_offset[] table keeps
+#  offset of each line in data[] array, so any line can be decoded without
+#  decoding previous lines. Each line consists from packets:
+#    0x80 | (N - 1), C       - run of N pixels of color C (N = 1..128)
+#    N - 1, C0, C1, ... CN-1 - N literal pixels (N = 1..128)
+#
+#*******************************************************************************
+
+import struct
+import sys
+
+# Maximum pixels in one packet
+MAX_PACKET = 128
+# Minimum repeated pixels to encode them as run
+MIN_RUN = 3
+
+
+# Convert RGB color to PALETTE_884 index: BBGGGRRR
+def rgb_to_884(r, g, b):
+  return ((b * 3 // 255) << 6) | ((g * 7 // 255) << 3) | (r * 7 // 255)
+
+
+# Read 24-bit BMP file and return list of lines with palette indexes
+def read_bmp(file_name):
+  data = open(file_name, 'rb').read()
+  if data[0:2] != b'BM':
+    raise ValueError('Not a BMP file')
+  offset = struct.unpack_from('<I', data, 10)[0]
+  width, height = struct.unpack_from('<ii', data, 18)
+  bpp = struct.unpack_from('<H', data, 28)[0]
+  if bpp != 24:
+    raise ValueError('Only 24-bit BMP files supported')
+  row_size = (width * 3 + 3) & ~3
+  lines = []
+  for y in range(abs(height)):
+    # Positive height means bottom-up bitmap
+    row = (abs(height) - 1 - y) if height > 0 else y
+    pos = offset + row * row_size
+    lines.append([rgb_to_884(data[pos + x * 3 + 2], data[pos + x * 3 + 1], data[pos + x * 3])
+                  for x in range(width)])
+  return width, lines
+
+
+# Encode one line
+def encode_line(line):
+  out = []
+  literal = []
+  i = 0
+  while i < len(line):
+    # Find run length
+    run = 1
+    while (i + run < len(line)) and (line[i + run] == line[i]) and (run < MAX_PACKET):
+      run += 1
+    if run >= MIN_RUN:
+      # Flush literal pixels before run
+      if literal:
+        out += [len(literal) - 1] + literal
+        literal = []
+      out += [0x80 | (run - 1), line[i]]
+      i += run
+    else:
+      literal.append(line[i])
+      if len(literal) == MAX_PACKET:
+        out += [len(literal) - 1] + literal
+        literal = []
+      i += 1
+  if literal:
+    out += [len(literal) - 1] + literal
+  return out
+
+
+# Decode one line, used to verify encoder
+def decode_line(data, width):
+  line = []
+  i = 0
+  while len(line) < width:
+    cnt = (data[i] & 0x7F) + 1
+    if data[i] & 0x80:
+      line += [data[i + 1]] * cnt
+      i += 2
+    else:
+      line += data[i + 1:i + 1 + cnt]
+      i += 1 + cnt
+  return line
+
+
+# Format array of values as C code
+def format_array(values, fmt, per_line):
+  lines = []
+  for i in range(0, len(values), per_line):
+    lines.append(', '.join(fmt % v for v in values[i:i + per_line]) + ',')
+  return '\n'.join(lines).rstrip(',')
+
+
+def main(argv):
+  if len(argv) != 5:
+    print('Usage: %s <file.bmp> <image height> <name> <output.h>' % argv[0])
+    return 1
+
+  width, lines = read_bmp(argv[1])
+  img_height = int(argv[2])
+  name = argv[3]
+  img_cnt = len(lines) // img_height
+
+  out = []
+  raw_size = 0
+  rle_size = 0
+  for n in range(img_cnt):
+    data = []
+    offsets = []
+    for y in range(img_height):
+      line = lines[n * img_height + y]
+      enc = encode_line(line)
+      # Verify encoded line
+      if decode_line(enc, width) != line:
+        raise RuntimeError('RLE verification failed')
+      offsets.append(len(data))
+      data += enc
+    if len(data) > 0xFFFF:
+      raise RuntimeError('Image is too big for 16-bit line offsets')
+    raw_size += width * img_height
+    rle_size += len(data) + len(offsets) * 2
+    out.append('const uint16_t %s_%d_line[] = {\n%s};\n' % (name, n, format_array(offsets, '%d', 16)))
+    out.append('const uint8_t %s_%d_data[] = {\n%s};\n' % (name, n, format_array(data, '0x%02X', 16)))
+
+  out.append('// Raw size: %d bytes, RLE size(with line offsets): %d bytes\n' % (raw_size, rle_size))
+  out.append('const RleImageDesc %s[] = {\n%s};\n' % (name, ',\n'.join(
+             '{%d, %d, %s_%d_line, %s_%d_data, PALETTE_884, -1}' % (width, img_height, name, n, name, n)
+             for n in range(img_cnt))))
+
+  open(argv[4], 'w').write('\n'.join(out))
+  print('%d images converted: %d -> %d bytes' % (img_cnt, raw_size, rle_size))
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main(sys.argv))
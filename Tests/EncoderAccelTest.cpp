@@ -0,0 +1,121 @@
+//******************************************************************************
+//  @file EncoderAccelTest.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details Tests: Encoder Acceleration Class host tests
+//
+//  @copyright Copyright (c) 2016, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "EncoderAccel.h"
+#include "TestCheck.h"
+
+// UI poll period of application task and idle time of EncoderAccel. Speed is
+// steps of one poll divided by poll interval.
+static const uint32_t POLL_MS = 100U;
+static const uint32_t IDLE_MS = 300U;
+
+// *****************************************************************************
+// ***   TestRampUp   **********************************************************
+// *****************************************************************************
+static void TestRampUp()
+{
+  EncoderAccel accel;
+  uint32_t time_ms = 1000U;
+
+  // First call has no previous poll, so speed isn't known
+  CHECK_EQ(accel.Process(1, time_ms), 1);
+  CHECK_EQ(accel.GetSpeed(), 0U);
+  // Two detents per poll are 20 detents per second, filter halves distance
+  // to it every poll: 10, 15, 17, 18
+  static const int32_t EXPECTED[] = {2, 4, 4, 4};
+  for(uint32_t i = 0U; i < sizeof(EXPECTED) / sizeof(EXPECTED[0U]); i++)
+  {
+    time_ms += POLL_MS;
+    CHECK_EQ(accel.Process(2, time_ms), EXPECTED[i]);
+  }
+  CHECK_EQ(accel.GetSpeed(), 18U);
+  // Faster rotation raises multiplier: 59 -> 10, 79 -> 25
+  time_ms += POLL_MS;
+  CHECK_EQ(accel.Process(10, time_ms), 100);
+  time_ms += POLL_MS;
+  CHECK_EQ(accel.Process(10, time_ms), 250);
+}
+
+// *****************************************************************************
+// ***   TestCap   *************************************************************
+// *****************************************************************************
+static void TestCap()
+{
+  EncoderAccel accel;
+  uint32_t time_ms = 1000U;
+
+  (void) accel.Process(1, time_ms);
+  // 1000 detents per second never give more than table maximum
+  for(uint32_t i = 0U; i < 20U; i++)
+  {
+    time_ms += POLL_MS;
+    CHECK_EQ(accel.Process(100, time_ms) <= 2500, true);
+  }
+  CHECK_EQ(accel.GetMultiplier(), 25U);
+  // Change of direction starts from slow speed
+  time_ms += POLL_MS;
+  CHECK_EQ(accel.Process(-1, time_ms), -1);
+  time_ms += POLL_MS;
+  CHECK_EQ(accel.Process(-100, time_ms), -2500);
+}
+
+// *****************************************************************************
+// ***   TestIdleReset   *******************************************************
+// *****************************************************************************
+static void TestIdleReset()
+{
+  EncoderAccel accel;
+  uint32_t time_ms = 1000U;
+
+  (void) accel.Process(1, time_ms);
+  for(uint32_t i = 0U; i < 5U; i++)
+  {
+    time_ms += POLL_MS;
+    (void) accel.Process(10, time_ms);
+  }
+  CHECK_EQ(accel.GetMultiplier(), 25U);
+  uint32_t last_step_ms = time_ms;
+  // Speed is kept until idle time passes
+  while(time_ms + POLL_MS < last_step_ms + IDLE_MS)
+  {
+    time_ms += POLL_MS;
+    CHECK_EQ(accel.Process(0, time_ms), 0);
+    CHECK_EQ(accel.GetMultiplier(), 25U);
+  }
+  time_ms += POLL_MS;
+  (void) accel.Process(0, time_ms);
+  CHECK_EQ(accel.GetSpeed(), 0U);
+  CHECK_EQ(accel.GetMultiplier(), 1U);
+  // Steps after polling paused for idle time give no speed at all
+  time_ms += IDLE_MS;
+  CHECK_EQ(accel.Process(30, time_ms), 30);
+  CHECK_EQ(accel.GetSpeed(), 0U);
+}
+
+// *****************************************************************************
+// ***   main   ****************************************************************
+// *****************************************************************************
+int main()
+{
+  TestRampUp();
+  TestCap();
+  TestIdleReset();
+  return TestResult("EncoderAccel");
+}
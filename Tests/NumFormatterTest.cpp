@@ -0,0 +1,154 @@
+//******************************************************************************
+//  @file NumFormatterTest.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details Tests: Number Formatter Class host tests and cycle comparison
+//                  with snprintf
+//
+//  @copyright Copyright (c) 2016, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "NumFormatter.h"
+#include "TestCheck.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+// *****************************************************************************
+// ***   FixedStr   ************************************************************
+// *****************************************************************************
+static const char* FixedStr(char* buf, uint32_t size, int32_t value, uint8_t decimals, uint8_t width)
+{
+  char* ptr = NumFormatter::Fixed(buf, buf + size - 1U, value, decimals, width);
+  *ptr = '\0';
+  return buf;
+}
+
+// *****************************************************************************
+// ***   TestFixed   ***********************************************************
+// *****************************************************************************
+static void TestFixed()
+{
+  char buf[32U] = {0};
+
+  CHECK_STR(FixedStr(buf, sizeof(buf), 0, 0U, 0U), "0");
+  CHECK_STR(FixedStr(buf, sizeof(buf), 5025, 2U, 0U), "50.25");
+  CHECK_STR(FixedStr(buf, sizeof(buf), -5, 2U, 0U), "-0.05");
+  CHECK_STR(FixedStr(buf, sizeof(buf), 42, 0U, 6U), "    42");
+  CHECK_STR(FixedStr(buf, sizeof(buf), INT32_MIN, 0U, 0U), "-2147483648");
+  CHECK_STR(FixedStr(buf, sizeof(buf), INT32_MAX, 9U, 0U), "2.147483647");
+  // Decimals above 10 overflowed the digit buffer, now they are limited
+  CHECK_STR(FixedStr(buf, sizeof(buf), INT32_MIN, 10U, 0U), "-0.2147483648");
+  CHECK_STR(FixedStr(buf, sizeof(buf), -1, 200U, 0U), "-0.0000000001");
+  // Output is cut at the end pointer
+  CHECK_STR(FixedStr(buf, 4U, 12345, 0U, 0U), "123");
+  CHECK_STR(FixedStr(buf, 4U, 1, 0U, 8U), "   ");
+}
+
+// *****************************************************************************
+// ***   TestFrequency   *******************************************************
+// *****************************************************************************
+static void TestFrequency()
+{
+  char buf[32U] = {0};
+
+  CHECK_EQ(NumFormatter::Frequency(buf, sizeof(buf), "Freq: ", 999U), 18U);
+  CHECK_STR(buf, "Freq:      999 Hz ");
+  (void) NumFormatter::Frequency(buf, sizeof(buf), "Freq: ", 12345U);
+  CHECK_STR(buf, "Freq:   12.345 kHz");
+  (void) NumFormatter::Frequency(buf, sizeof(buf), "Freq: ", 1234567U);
+  CHECK_STR(buf, "Freq: 1.234567 MHz");
+  // Short buffer is terminated, empty buffer isn't touched
+  CHECK_EQ(NumFormatter::Frequency(buf, 8U, "Freq: ", 1000U), 7U);
+  CHECK_STR(buf, "Freq:  ");
+  CHECK_EQ(NumFormatter::Frequency(buf, 0U, "Freq: ", 1000U), 0U);
+  CHECK_EQ(NumFormatter::Frequency(nullptr, 8U, "Freq: ", 1000U), 0U);
+}
+
+// *****************************************************************************
+// ***   TestValueAndTime   ****************************************************
+// *****************************************************************************
+static void TestValueAndTime()
+{
+  char buf[32U] = {0};
+  char* ptr;
+
+  (void) NumFormatter::Value(buf, sizeof(buf), "Duty: ", 5025, 2U, "%");
+  CHECK_STR(buf, "Duty:    50.25 %");
+  (void) NumFormatter::Value(buf, sizeof(buf), "Ampl: ", -3300, 0U, "mV");
+  CHECK_STR(buf, "Ampl:    -3300 mV");
+
+  ptr = NumFormatter::Time(buf, buf + sizeof(buf) - 1U, 500U);
+  *ptr = '\0';
+  CHECK_STR(buf, "500ms");
+  ptr = NumFormatter::Time(buf, buf + sizeof(buf) - 1U, 1500U);
+  *ptr = '\0';
+  CHECK_STR(buf, "1.5s");
+
+  ptr = NumFormatter::TimePs(buf, buf + sizeof(buf) - 1U, 11900U);
+  *ptr = '\0';
+  CHECK_STR(buf, "11.90ns");
+  ptr = NumFormatter::TimePs(buf, buf + sizeof(buf) - 1U, 1250000U);
+  *ptr = '\0';
+  CHECK_STR(buf, "1.250us");
+  ptr = NumFormatter::TimePs(buf, buf + sizeof(buf) - 1U, 500000000U);
+  *ptr = '\0';
+  CHECK_STR(buf, "500.0us");
+}
+
+// *****************************************************************************
+// ***   Benchmark   ***********************************************************
+// *****************************************************************************
+// Host time per string of NumFormatter and snprintf for the same output. It
+// shows ratio only, target cycles are in "Fmt:" field of debug line.
+static void Benchmark()
+{
+  static const uint32_t ITERATIONS = 1000000U;
+  char buf[32U] = {0};
+  volatile uint32_t sink = 0U;
+
+  auto start = std::chrono::steady_clock::now();
+  for(uint32_t i = 0U; i < ITERATIONS; i++)
+  {
+    sink = sink + NumFormatter::Frequency(buf, sizeof(buf), "Freq: ", 1000000U + i);
+  }
+  auto mid = std::chrono::steady_clock::now();
+  for(uint32_t i = 0U; i < ITERATIONS; i++)
+  {
+    uint32_t freq = 1000000U + i;
+    sink = sink + snprintf(buf, sizeof(buf), "Freq: %lu.%06lu MHz", (unsigned long)(freq / 1000000U),
+                           (unsigned long)(freq % 1000000U));
+  }
+  auto stop = std::chrono::steady_clock::now();
+
+  double fmt_ns = std::chrono::duration<double, std::nano>(mid - start).count() / ITERATIONS;
+  double printf_ns = std::chrono::duration<double, std::nano>(stop - mid).count() / ITERATIONS;
+  printf("NumFormatter::Frequency: %.1f ns, snprintf: %.1f ns per string\n", fmt_ns, printf_ns);
+}
+
+// *****************************************************************************
+// ***   main   ****************************************************************
+// *****************************************************************************
+int main(int argc, char* argv[])
+{
+  TestFixed();
+  TestFrequency();
+  TestValueAndTime();
+  if((argc > 1) && (strcmp(argv[1], "--bench") == 0))
+  {
+    Benchmark();
+  }
+  return TestResult("NumFormatter");
+}
@@ -0,0 +1,69 @@
+//******************************************************************************
+//  @file TestCheck.h
+//  @author Nicolai Shlapunov
+//
+//  @details Tests: Minimal check macros for host tests, header
+//
+//  @copyright Copyright (c) 2016, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef TestCheck_h
+#define TestCheck_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include <cstdio>
+#include <cstring>
+
+// *****************************************************************************
+// ***   Check Macros   ********************************************************
+// *****************************************************************************
+//
+// Application classes without HAL dependencies are built for host and checked
+// by these macros. Failed check is printed and test continues, so one run
+// shows all failures.
+//
+static unsigned int test_failures = 0U;
+
+#define CHECK_EQ(actual, expected) \
+  do { \
+    long long a_ = (long long)(actual); \
+    long long e_ = (long long)(expected); \
+    if(a_ != e_) \
+    { \
+      printf("%s:%d: %s is %lld, expected %lld\n", __FILE__, __LINE__, #actual, a_, e_); \
+      test_failures++; \
+    } \
+  } while(0)
+
+#define CHECK_STR(actual, expected) \
+  do { \
+    const char* a_ = (actual); \
+    const char* e_ = (expected); \
+    if(strcmp(a_, e_) != 0) \
+    { \
+      printf("%s:%d: %s is \"%s\", expected \"%s\"\n", __FILE__, __LINE__, #actual, a_, e_); \
+      test_failures++; \
+    } \
+  } while(0)
+
+// *****************************************************************************
+// ***   TestResult   **********************************************************
+// *****************************************************************************
+// Print result and return exit code for make
+static inline int TestResult(const char* name)
+{
+  printf("%s: %s\n", name, (test_failures == 0U) ? "OK" : "FAILED");
+  return (test_failures == 0U) ? 0 : 1;
+}
+
+#endif